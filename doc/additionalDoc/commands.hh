@@ -131,6 +131,56 @@
 	      <td>&nbsp;</td>
 	      <td>Do not require computation of forces and torques on each joint.</td>
 	    </tr>
+	    <tr><td>&nbsp;</td>
+	    </tr>
+	    <tr>
+	      <td>"ComputeActuatorDynamics"</td>
+	      <td>&nbsp;</td>
+	      <td>"true"</td>
+	      <td>&nbsp;</td>
+	      <td>Take rotor inertia and joint friction into account in inertia matrix and joint torques.</td>
+	    </tr>
+	    <tr>
+	      <td>"ComputeActuatorDynamics"</td>
+	      <td>&nbsp;</td>
+	      <td>"false"</td>
+	      <td>&nbsp;</td>
+	      <td>Ignore rotor inertia and joint friction.</td>
+	    </tr>
+	    <tr><td>&nbsp;</td>
+	    </tr>
+	    <tr>
+	      <td>"ParallelSubtrees"</td>
+	      <td>&nbsp;</td>
+	      <td>"true"</td>
+	      <td>&nbsp;</td>
+	      <td>Compute forward kinematics and the forward pass of inverse dynamics of independent subtrees of the kinematic chain in parallel, when worthwhile.</td>
+	    </tr>
+	    <tr>
+	      <td>"ParallelSubtrees"</td>
+	      <td>&nbsp;</td>
+	      <td>"false"</td>
+	      <td>&nbsp;</td>
+	      <td>Compute all subtrees sequentially.</td>
+	    </tr>
+	    <tr><td>&nbsp;</td>
+	    </tr>
+	    <tr>
+	      <td>"ParallelSubtreesThreads"</td>
+	      <td>&nbsp;</td>
+	      <td>"n"</td>
+	      <td>&nbsp;</td>
+	      <td>Maximal number of threads used for parallel subtrees. "0" uses as many threads as the hardware supports.</td>
+	    </tr>
+	    <tr><td>&nbsp;</td>
+	    </tr>
+	    <tr>
+	      <td>"ParallelSubtreesMinimumDof"</td>
+	      <td>&nbsp;</td>
+	      <td>"n"</td>
+	      <td>&nbsp;</td>
+	      <td>Minimal number of degrees of freedom of a subtree for it to be computed by a separate thread. Smaller subtrees are computed sequentially. The default value is chosen by the implementation from the measured cost of thread synchronization.</td>
+	    </tr>
 	  </table>
 	</div>
       </div>
@@ -43,6 +43,12 @@ Some types or classes need to be provided by the implementation. These types are
 
 \note From the choices of these types will of course depend the compatibility between an implementation and a module using the interfaces.
 
+The classes CjrlJoint, CjrlBody, CjrlDynamicRobot, CjrlRigidVelocity and CjrlRigidAcceleration are the instantiations for double of class templates parameterized by the scalar type (CjrlJointTpl, CjrlBodyTpl, CjrlDynamicRobotTpl, CjrlRigidVelocityTpl and CjrlRigidAccelerationTpl). The types above are obtained for a given scalar type through CjrlScalarTraits. An implementation supporting another scalar type, for instance float or an automatic differentiation type, specializes CjrlScalarTraits for this type and derives from the corresponding instantiations.
+
+When the package is configured with option <tt>USE_EIGEN</tt>, macro <tt>ABSTRACT_ROBOT_DYNAMICS_USE_EIGEN</tt> is exported through pkg-config and CjrlScalarTraits provides Eigen types for any scalar type. 3D vectors, 3 by 3 and 4 by 4 matrices are then fixed-size, stack-allocated types. Implementation classes storing a matrix4d by value must use <tt>EIGEN_MAKE_ALIGNED_OPERATOR_NEW</tt>.
+
+\note As CjrlJoint, CjrlBody and CjrlDynamicRobot are type definitions, they cannot be forward declared as classes. Include <tt>abstract-robot-dynamics/fwd.hh</tt> instead.
+
 \section abstractRobotDynamics_exporting Exporting the name of the classes
 
 Let us assume that the package named <tt>impl1RobotDynamics</tt> provides an implementation of the abstract interface with:
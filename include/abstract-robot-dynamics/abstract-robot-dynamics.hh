@@ -17,8 +17,11 @@
 #ifndef ABSTRACT_ROBOT_DYNAMICS_HH
 # define ABSTRACT_ROBOT_DYNAMICS_HH
 
+# include <abstract-robot-dynamics/async-computation.hh>
+# include <abstract-robot-dynamics/batch-evaluator.hh>
 # include <abstract-robot-dynamics/body.hh>
 # include <abstract-robot-dynamics/dynamic-robot.hh>
+# include <abstract-robot-dynamics/dynamic-robot-data.hh>
 # include <abstract-robot-dynamics/foot.hh>
 # include <abstract-robot-dynamics/fwd.hh>
 # include <abstract-robot-dynamics/hand.hh>
@@ -28,5 +31,7 @@
 # include <abstract-robot-dynamics/rigid-acceleration.hh>
 # include <abstract-robot-dynamics/rigid-velocity.hh>
 # include <abstract-robot-dynamics/robot-dynamics-object-constructor.hh>
+# include <abstract-robot-dynamics/scalar-traits.hh>
+# include <abstract-robot-dynamics/spatial-algebra.hh>
 
 #endif //! ABSTRACT_ROBOT_DYNAMICS_HH
@@ -0,0 +1,54 @@
+// Copyright 2026, CNRS/AIST
+//
+// This file is part of abstract-robot-dynamics.
+// abstract-robot-dynamics is free software: you can redistribute it
+// and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version
+// 3 of the License, or (at your option) any later version.
+//
+// abstract-robot-dynamics is distributed in the hope that it will be
+// useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+// of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Lesser Public License for more details.  You should have
+// received a copy of the GNU Lesser General Public License along with
+// abstract-robot-dynamics.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef ABSTRACT_ROBOT_DYNAMICS_ASYNC_COMPUTATION_HH
+# define ABSTRACT_ROBOT_DYNAMICS_ASYNC_COMPUTATION_HH
+# include <abstract-robot-dynamics/fwd.hh>
+
+/**
+   \brief Handle on a computation running in the background.
+
+   Asynchronous methods of CjrlDynamicRobot, like
+   CjrlDynamicRobot::computeInertiaMatrixAsync(), start a computation
+   and return an object of this class. The computation writes its
+   result into an output argument given by the caller, that must not
+   be accessed before ready() returns true or wait() returns.
+
+   The object is owned by the caller. Deleting it waits for the end of
+   the computation. It must be deleted before the robot that started
+   the computation is destroyed.
+*/
+class CjrlAsyncComputation
+{
+public:
+  /// \brief Destructor.
+  ///
+  /// Wait for the end of the computation.
+  virtual ~CjrlAsyncComputation() {}
+
+  /// \brief Whether the computation is over.
+  ///
+  /// This method does not wait.
+  virtual bool ready() const = 0;
+
+  /// \brief Wait for the end of the computation.
+  ///
+  /// \return true if the computation succeeded, false otherwise, for
+  /// instance if the output argument has an inadequate size.
+  virtual bool wait() = 0;
+};
+
+#endif //! ABSTRACT_ROBOT_DYNAMICS_ASYNC_COMPUTATION_HH
@@ -0,0 +1,127 @@
+// Copyright 2026, CNRS/AIST
+//
+// This file is part of abstract-robot-dynamics.
+// abstract-robot-dynamics is free software: you can redistribute it
+// and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version
+// 3 of the License, or (at your option) any later version.
+//
+// abstract-robot-dynamics is distributed in the hope that it will be
+// useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+// of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Lesser Public License for more details.  You should have
+// received a copy of the GNU Lesser General Public License along with
+// abstract-robot-dynamics.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef ABSTRACT_ROBOT_DYNAMICS_BATCH_EVALUATOR_HH
+# define ABSTRACT_ROBOT_DYNAMICS_BATCH_EVALUATOR_HH
+# include <vector>
+
+# include <abstract-robot-dynamics/fwd.hh>
+# include <abstract-robot-dynamics/scalar-traits.hh>
+# include <abstract-robot-dynamics/dynamic-robot.hh>
+
+/**
+   \brief Evaluation of the kinematics and dynamics of a robot for
+   many states.
+
+   A batch evaluator computes, for each column \f$k\f$ of the input
+   matrices, the state \f$({\bf q}_k, {\bf \dot{q}}_k, {\bf
+   \ddot{q}}_k)\f$ of the robot it has been created for (see
+   CjrlRobotDynamicsObjectFactory::createBatchEvaluator), and writes
+   the requested outputs into matrices allocated by the caller.
+
+   Implementations are expected to distribute the samples over a pool
+   of threads, each thread using its own CjrlDynamicRobotData. The
+   robot must thus not be modified during an evaluation.
+
+   CjrlBatchEvaluator is the instantiation for double.
+*/
+template <typename Scalar>
+class CjrlBatchEvaluatorTpl
+{
+public:
+  /// \name Types for the scalar type
+  /// \{
+
+  typedef typename CjrlScalarTraits<Scalar>::matrixNxP matrixNxP;
+  typedef CjrlJointTpl<Scalar> CjrlJoint;
+  typedef CjrlDynamicRobotTpl<Scalar> CjrlDynamicRobot;
+  typedef CjrlRigidTransformationTpl<Scalar> CjrlRigidTransformation;
+
+  /// \}
+
+  /// \brief Outputs that can be requested from evaluate().
+  ///
+  /// Outputs are combined with operator |.
+  enum Output
+    {
+      /// Joint torques computed by inverse dynamics.
+      TORQUES = 1,
+      /// Inertia matrix.
+      INERTIA_MATRIX = 2,
+      /// Position of the center of mass.
+      CENTER_OF_MASS = 4,
+      /// Placements of the joints given to frames().
+      JOINT_PLACEMENTS = 8
+    };
+
+  /// \brief Destructor.
+  virtual ~CjrlBatchEvaluatorTpl() {}
+
+  /// \brief Get the robot the evaluator has been created for.
+  virtual const CjrlDynamicRobot& robot() const = 0;
+
+  /// \brief Get the number of threads used by evaluate().
+  virtual unsigned int numberThreads() const = 0;
+
+  /// \brief Set the joints whose placements are computed.
+  ///
+  /// \param inJoints joints of the robot, in the order of the
+  /// placements written by evaluate().
+  virtual void frames(const std::vector<const CjrlJoint*>& inJoints) = 0;
+
+  /**
+     \brief Evaluate a batch of states.
+
+     \param inConfigs configurations, one per column.
+     \param inVelocities velocities, one per column. May be empty if
+     only configuration dependent outputs are requested.
+     \param inAccelerations accelerations, one per column. May be empty
+     if TORQUES is not requested.
+     \param inOutputs combination of values of Output.
+
+     \retval outTorques joint torques, one column per sample. Written
+     if inOutputs contains TORQUES.
+     \retval outInertiaMatrices inertia matrices, the matrix of sample
+     \f$k\f$ being stored in the columns \f$k\,n\f$ to \f$(k+1)\,n-1\f$
+     where \f$n\f$ is CjrlDynamicRobot::numberVelocityDof(). Written if
+     inOutputs contains INERTIA_MATRIX.
+     \retval outCentersOfMass positions of the center of mass, one
+     column of size 3 per sample. Written if inOutputs contains
+     CENTER_OF_MASS.
+     \retval outPlacements placements of the joints given to frames(),
+     the placement of joint \f$j\f$ for sample \f$k\f$ being at index
+     \f$k\,m + j\f$ where \f$m\f$ is the number of joints. Written if
+     inOutputs contains JOINT_PLACEMENTS.
+
+     Outputs must be allocated to their size by the caller, so that
+     the evaluation does not allocate memory. Outputs that are not
+     requested are not accessed and may be empty.
+
+     \return false if the dimensions of the inputs or outputs do not
+     fit.
+  */
+  virtual bool
+  evaluate(const matrixNxP& inConfigs,
+	   const matrixNxP& inVelocities,
+	   const matrixNxP& inAccelerations,
+	   unsigned int inOutputs,
+	   matrixNxP& outTorques,
+	   matrixNxP& outInertiaMatrices,
+	   matrixNxP& outCentersOfMass,
+	   std::vector<CjrlRigidTransformation>& outPlacements) = 0;
+};
+
+#endif //! ABSTRACT_ROBOT_DYNAMICS_BATCH_EVALUATOR_HH
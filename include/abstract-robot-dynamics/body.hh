@@ -17,10 +17,24 @@
 #ifndef ABSTRACT_ROBOT_DYNAMICS_BODY_HH
 # define ABSTRACT_ROBOT_DYNAMICS_BODY_HH
 # include <abstract-robot-dynamics/fwd.hh>
+# include <abstract-robot-dynamics/scalar-traits.hh>
 
-class CjrlBody
+/// \brief This class represents the body attached to a joint.
+///
+/// CjrlBody is the instantiation for double.
+template <typename Scalar>
+class CjrlBodyTpl
 {
 public:
+  /// \name Types for the scalar type
+  /// \{
+
+  typedef typename CjrlScalarTraits<Scalar>::vector3d vector3d;
+  typedef typename CjrlScalarTraits<Scalar>::matrix3d matrix3d;
+  typedef CjrlJointTpl<Scalar> CjrlJoint;
+
+  /// \}
+
   /// \brief Get position of center of mass in joint local reference frame.
   virtual const vector3d& localCenterOfMass() const = 0;
 
@@ -34,16 +48,16 @@ public:
   virtual void inertiaMatrix(const matrix3d& inInertiaMatrix) = 0;
 
   /// \brief Get mass.
-  virtual double mass() const = 0;
+  virtual Scalar mass() const = 0;
 
   /// \brief Set mass.
-  virtual void mass(double inMass) = 0;
+  virtual void mass(Scalar inMass) = 0;
 
   /// \brief Get const pointer to the joint the body is attached to.
   virtual const CjrlJoint* joint() const = 0;
 
   /// \brief Destructor
-  virtual ~CjrlBody() {}
+  virtual ~CjrlBodyTpl() {}
 };
 
 #endif //! ABSTRACT_ROBOT_DYNAMICS_BODY_HH
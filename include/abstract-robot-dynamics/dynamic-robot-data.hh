@@ -0,0 +1,183 @@
+// Copyright 2026, CNRS/AIST
+//
+// This file is part of abstract-robot-dynamics.
+// abstract-robot-dynamics is free software: you can redistribute it
+// and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version
+// 3 of the License, or (at your option) any later version.
+//
+// abstract-robot-dynamics is distributed in the hope that it will be
+// useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+// of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Lesser Public License for more details.  You should have
+// received a copy of the GNU Lesser General Public License along with
+// abstract-robot-dynamics.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef ABSTRACT_ROBOT_DYNAMICS_DYNAMIC_ROBOT_DATA_HH
+# define ABSTRACT_ROBOT_DYNAMICS_DYNAMIC_ROBOT_DATA_HH
+# include <abstract-robot-dynamics/fwd.hh>
+# include <abstract-robot-dynamics/scalar-traits.hh>
+# include <abstract-robot-dynamics/joint.hh>
+
+/**
+   \brief State of a robot, separated from its model.
+
+   A CjrlDynamicRobot holds both the model of the robot (kinematic
+   tree, bodies, bounds) and a current state (configuration, velocity,
+   acceleration and the values computed from them). An object of this
+   class holds only a state and the associated caches, and reads the
+   model from the robot that created it (see
+   CjrlDynamicRobot::createData()).
+
+   Several data objects created by the same robot can be used
+   concurrently, one per thread, to evaluate the kinematics and the
+   dynamics of the robot in different states without duplicating the
+   model.
+
+   \par Thread safety
+   Once the robot is initialized, its model must not be modified as
+   long as data objects created by it exist. Under this condition,
+   calls to methods of distinct data objects can be made concurrently.
+   A data object must not be used by several threads at the same time.
+
+   Data objects are also used to publish snapshots of the state of a
+   robot to other threads (see CjrlDynamicRobot::publishState()).
+
+   CjrlDynamicRobotData is the instantiation for double.
+*/
+template <typename Scalar>
+class CjrlDynamicRobotDataTpl
+{
+public:
+  /// \name Types for the scalar type
+  /// \{
+
+  typedef typename CjrlScalarTraits<Scalar>::vector3d vector3d;
+  typedef typename CjrlScalarTraits<Scalar>::vectorN vectorN;
+  typedef typename CjrlScalarTraits<Scalar>::matrixNxP matrixNxP;
+  typedef CjrlJointTpl<Scalar> CjrlJoint;
+  typedef CjrlDynamicRobotTpl<Scalar> CjrlDynamicRobot;
+  typedef CjrlRigidVelocityTpl<Scalar> CjrlRigidVelocity;
+  typedef CjrlRigidAccelerationTpl<Scalar> CjrlRigidAcceleration;
+  typedef CjrlRigidTransformationTpl<Scalar> CjrlRigidTransformation;
+
+  /// \}
+
+  /// \brief Destructor.
+  virtual ~CjrlDynamicRobotDataTpl() {}
+
+  /// \brief Get the robot providing the model.
+  virtual const CjrlDynamicRobot& model() const = 0;
+
+  /// \name Configuration, velocity and acceleration
+  /// \{
+
+  /// \brief Set the configuration.
+  ///
+  /// \return false if the dimension of the vector does not fit.
+  ///
+  /// \sa CjrlDynamicRobot::currentConfiguration(const vectorN&)
+  virtual bool currentConfiguration(const vectorN& inConfig) = 0;
+
+  /// \brief Get the configuration.
+  virtual const vectorN& currentConfiguration() const = 0;
+
+  /// \brief Get the version of the configuration.
+  ///
+  /// \sa CjrlDynamicRobot::configurationVersion()
+  virtual unsigned long configurationVersion() const = 0;
+
+  /// \brief Set the velocity.
+  ///
+  /// \return false if the dimension of the vector does not fit.
+  virtual bool currentVelocity(const vectorN& inVelocity) = 0;
+
+  /// \brief Get the velocity.
+  virtual const vectorN& currentVelocity() const = 0;
+
+  /// \brief Set the acceleration.
+  ///
+  /// \return false if the dimension of the vector does not fit.
+  virtual bool currentAcceleration(const vectorN& inAcceleration) = 0;
+
+  /// \brief Get the acceleration.
+  virtual const vectorN& currentAcceleration() const = 0;
+
+  /// \}
+
+  /// \name Kinematics and dynamics
+  /// \{
+
+  /// \brief Compute forward kinematics.
+  ///
+  /// \sa CjrlDynamicRobot::computeForwardKinematics()
+  virtual bool computeForwardKinematics() = 0;
+
+  /// \brief Get the current placement of a joint of the model.
+  ///
+  /// \sa CjrlJoint::currentPlacement()
+  virtual const CjrlRigidTransformation&
+  jointPlacement(const CjrlJoint& inJoint) const = 0;
+
+  /// \brief Get the current velocity of a joint of the model.
+  ///
+  /// \sa CjrlJoint::currentVelocity()
+  virtual const CjrlRigidVelocity&
+  jointVelocity(const CjrlJoint& inJoint) const = 0;
+
+  /// \brief Get the current acceleration of a joint of the model.
+  ///
+  /// \sa CjrlJoint::currentAcceleration()
+  virtual const CjrlRigidAcceleration&
+  jointAcceleration(const CjrlJoint& inJoint) const = 0;
+
+  /// \brief Get the position of the center of mass.
+  virtual const vector3d& positionCenterOfMass() const = 0;
+
+  /// \brief Get the coordinates of the Zero Momentum Point.
+  ///
+  /// \retval outZeroMomentumPoint the Zero Momentum Point, written only
+  /// if true is returned.
+  ///
+  /// \return false if the model is not a humanoid robot or if the
+  /// implementation does not compute it.
+  ///
+  /// \sa CjrlHumanoidDynamicRobot::zeroMomentumPoint()
+  virtual bool zeroMomentumPoint(vector3d& outZeroMomentumPoint) const;
+
+  /// \brief Compute the jacobian of a point of a joint.
+  ///
+  /// Same as CjrlDynamicRobot::getJacobian(), in the state of this
+  /// object.
+  virtual bool getJacobian(const CjrlJoint& inStartJoint,
+			   const CjrlJoint& inEndJoint,
+			   const vector3d& inFrameLocalPosition,
+			   matrixNxP& outjacobian,
+			   unsigned int offset = 0,
+			   bool inIncludeStartFreeFlyer = true) = 0;
+
+  /// \brief Compute the inertia matrix.
+  ///
+  /// \sa CjrlDynamicRobot::computeInertiaMatrix()
+  virtual void computeInertiaMatrix() = 0;
+
+  /// \brief Get the inertia matrix computed by computeInertiaMatrix().
+  virtual const matrixNxP& inertiaMatrix() const = 0;
+
+  /// \brief Get the joint torques computed by inverse dynamics.
+  ///
+  /// \sa CjrlDynamicRobot::currentJointTorques()
+  virtual const vectorN& currentJointTorques() const = 0;
+
+  /// \}
+};
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotDataTpl<Scalar>::zeroMomentumPoint(vector3d&) const
+{
+  return false;
+}
+
+#endif //! ABSTRACT_ROBOT_DYNAMICS_DYNAMIC_ROBOT_DATA_HH
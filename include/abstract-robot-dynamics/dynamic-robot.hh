@@ -21,8 +21,12 @@
 
 #ifndef ABSTRACT_ROBOT_DYNAMICS_ROBOT_HH
 # define ABSTRACT_ROBOT_DYNAMICS_ROBOT_HH
+# include <cstddef>
+
 # include <abstract-robot-dynamics/fwd.hh>
 # include <abstract-robot-dynamics/joint.hh>
+# include <abstract-robot-dynamics/dynamic-robot-data.hh>
+# include <abstract-robot-dynamics/async-computation.hh>
 
 /**
    \brief Abstract class that instantiates a robot with dynamic properties.
@@ -37,7 +41,13 @@
    freedom. The dimension of this vector is denoted by \f$n_{dof}\f$.
 
    The time derivative \f${\bf \dot{q}}\f$ of the configuration vector
-   is called the <b>velocity vector</b>.
+   is called the <b>velocity vector</b>. Its dimension, denoted by
+   \f$n_v\f$ and returned by numberVelocityDof(), is equal to
+   \f$n_{dof}\f$ unless the robot contains joints, like quaternion
+   freeflyer joints, whose velocity has less components than their
+   configuration. Velocities, accelerations, torques and jacobian
+   columns are indexed by rank in the velocity vector (see
+   CjrlJoint::rankInVelocity).
 
    The time derivative \f${\bf \ddot{q}}\f$ of the velocity vector. is
    called the <b>acceleration vector</b>.
@@ -53,14 +63,60 @@
    keep some compatibility, some recommended methods are listed in
    \ref abstractRobotDynamics_commands "this page".
 
+   \par Real-time mode
+   After initialize(), a robot can be switched to real-time mode by
+   enterRealTimeMode(). In this mode, the methods computing or
+   returning kinematic and dynamic values by reference or into output
+   arguments must not allocate memory, provided output matrices have
+   the right size. If an implementation nevertheless needs to allocate
+   memory, it calls the hook given to enterRealTimeMode() before, so
+   that the application can log the allocation or abort. Methods
+   returning containers by value, properties (see getProperty()) and
+   methods creating objects are not real-time safe.
+
    \par Actuated Joints.
    In order to make a distinction between actuated joints and none
    actuacted joints,
    a vector of actuated joints is provided through method:  getActuatedJoints().
+
+   \par Model and data
+   A robot holds both its model and a current state. In order to
+   evaluate several states in parallel, createData() returns objects
+   holding only a state and the associated caches, that share the model
+   of the robot (see CjrlDynamicRobotData).
+
+   \par Thread safety
+   Methods of a robot must not be called concurrently, except const
+   methods related to the model (kinematic chain, bounds, masses,
+   numbers of degrees of freedom) once the robot is initialized.
+   Concurrent computations should use one data object per thread.
+   acquirePublishedState() and releasePublishedState() can be called
+   from any thread, concurrently with any other method.
+
+   \par Scalar type
+   CjrlDynamicRobot is the instantiation for double. Implementations
+   providing the specialization of CjrlScalarTraits for another scalar
+   type, for instance float or an automatic differentiation type, can
+   derive from the corresponding instantiation.
 */
-class CjrlDynamicRobot
+template <typename Scalar>
+class CjrlDynamicRobotTpl
 {
 public:
+  /// \name Types for the scalar type
+  /// \{
+
+  typedef typename CjrlScalarTraits<Scalar>::vector3d vector3d;
+  typedef typename CjrlScalarTraits<Scalar>::matrix4d matrix4d;
+  typedef typename CjrlScalarTraits<Scalar>::vectorN vectorN;
+  typedef typename CjrlScalarTraits<Scalar>::matrixNxP matrixNxP;
+  typedef CjrlJointTpl<Scalar> CjrlJoint;
+  typedef CjrlRigidVelocityTpl<Scalar> CjrlRigidVelocity;
+  typedef CjrlRigidAccelerationTpl<Scalar> CjrlRigidAcceleration;
+  typedef CjrlDynamicRobotDataTpl<Scalar> CjrlDynamicRobotData;
+
+  /// \}
+
   /// \name Initialization
   /// \{
 
@@ -69,7 +125,72 @@ public:
   virtual bool initialize() = 0;
 
   /// \brief Destructor
-  virtual ~CjrlDynamicRobot() {}
+  virtual ~CjrlDynamicRobotTpl() {}
+
+  /// \brief Construct and return a pointer to a new state of the robot.
+  ///
+  /// The returned object shares the model of this robot and holds its
+  /// own configuration, velocity, acceleration and computed values. It
+  /// must be deleted by the caller, before this robot.
+  ///
+  /// \return 0 if the implementation does not separate the model from
+  /// the state.
+  virtual CjrlDynamicRobotData* createData() const;
+
+  /// \brief Construct and return a pointer to a copy of the robot.
+  ///
+  /// The copy owns new joints and bodies, with the same kinematic
+  /// chain, the same properties and the same state as this robot, and
+  /// is initialized. It is thus much faster to obtain than a robot
+  /// rebuilt through CjrlRobotDynamicsObjectFactory.
+  ///
+  /// The copy and its joints and bodies are owned by the caller, that
+  /// deletes the copy. They are never allocated from the arena of a
+  /// factory (see CjrlRobotDynamicsObjectFactory::usesArena()), even
+  /// if this robot was built from arena allocated objects, so the copy
+  /// remains valid after the arena is released.
+  ///
+  /// \return 0 if not implemented.
+  virtual CjrlDynamicRobotTpl* clone() const;
+
+  /// \}
+
+  /// \name Published states
+  ///
+  /// A thread updating the robot, typically a control loop, can
+  /// publish consistent snapshots of its state, that other threads
+  /// read without locking the robot. Implementations keep several
+  /// buffers (three for one reader) so that publishing and reading
+  /// never wait for each other.
+  /// \{
+
+  /// \brief Publish the current state of the robot.
+  ///
+  /// Copy the configuration, velocity, acceleration and the values
+  /// computed from them since the last configuration change into a
+  /// free buffer, and make this buffer the latest published state.
+  /// This method does not wait for readers and does not allocate
+  /// memory.
+  ///
+  /// \return false if not implemented or if no buffer is free because
+  /// readers hold all the previously published states.
+  virtual bool publishState();
+
+  /// \brief Get the latest published state.
+  ///
+  /// The returned state is not modified by subsequent calls to
+  /// publishState() until it is given back to
+  /// releasePublishedState(). This method does not wait for the
+  /// thread publishing states.
+  ///
+  /// \return 0 if not implemented or if no state has been published.
+  virtual const CjrlDynamicRobotData* acquirePublishedState() const;
+
+  /// \brief Give back a state returned by acquirePublishedState().
+  ///
+  /// The buffer of the state can then be reused by publishState().
+  virtual void
+  releasePublishedState(const CjrlDynamicRobotData* inState) const;
 
   /// \}
 
@@ -93,37 +214,58 @@ public:
 		const CjrlJoint& inEndJoint) const = 0;
 
   /// \brief Get the upper bound for ith dof.
-  virtual double upperBoundDof(unsigned int inRankInConfiguration) = 0;
+  virtual Scalar upperBoundDof(unsigned int inRankInConfiguration) = 0;
 
   /// \brief Get the lower bound for ith dof.
-  virtual double lowerBoundDof(unsigned int inRankInConfiguration) = 0;
+  virtual Scalar lowerBoundDof(unsigned int inRankInConfiguration) = 0;
 
   /// \brief Compute the upper bound for ith dof using other
   /// configuration values if possible.
-  virtual double upperBoundDof(unsigned int inRankInConfiguration,
+  virtual Scalar upperBoundDof(unsigned int inRankInConfiguration,
 			       const vectorN& inConfig) = 0;
 
   /// \brief Compute the lower bound for ith dof using other
   /// configuration values if possible.
-  virtual double lowerBoundDof(unsigned int inRankInConfiguration,
+  virtual Scalar lowerBoundDof(unsigned int inRankInConfiguration,
 			       const vectorN& inConfig) = 0;
 
-  /// \brief Get the upper velocity bound for ith dof.
-  virtual double upperVelocityBoundDof(unsigned int inRankInConfiguration) = 0;
+  /// \brief Get the upper velocity bound for ith velocity dof.
+  ///
+  /// \param inRankInVelocity rank in the velocity vector.
+  virtual Scalar upperVelocityBoundDof(unsigned int inRankInVelocity) = 0;
 
-  /// \brief Get the lower velocity bound for ith dof.
-  virtual double lowerVelocityBoundDof(unsigned int inRankInConfiguration) = 0;
+  /// \brief Get the lower velocity bound for ith velocity dof.
+  ///
+  /// \param inRankInVelocity rank in the velocity vector.
+  virtual Scalar lowerVelocityBoundDof(unsigned int inRankInVelocity) = 0;
 
-  /// \brief Get the upper torque bound for ith dof.
-  virtual double upperTorqueBoundDof(unsigned int inRankInConfiguration) = 0;
+  /// \brief Get the upper torque bound for ith velocity dof.
+  ///
+  /// \param inRankInVelocity rank in the velocity vector.
+  virtual Scalar upperTorqueBoundDof(unsigned int inRankInVelocity) = 0;
 
-  /// \brief Get the lower torque bound for ith dof.
-  virtual double lowerTorqueBoundDof(unsigned int inRankInConfiguration) = 0;
+  /// \brief Get the lower torque bound for ith velocity dof.
+  ///
+  /// \param inRankInVelocity rank in the velocity vector.
+  virtual Scalar lowerTorqueBoundDof(unsigned int inRankInVelocity) = 0;
 
 
   /// \brief Get the number of degrees of freedom of the robot.
+  ///
+  /// This is the size of the configuration vector.
   virtual unsigned int numberDof() const = 0;
 
+  /// \brief Get the number of velocity degrees of freedom of the robot.
+  ///
+  /// This is the size of the velocity and acceleration vectors, of the
+  /// torque vector and the number of columns of the jacobians. It
+  /// differs from numberDof() when the robot contains joints with a
+  /// number of configuration variables different from their number of
+  /// velocity degrees of freedom, like quaternion freeflyer joints (see
+  /// CjrlJoint::numberVelocityDof). The default implementation returns
+  /// numberDof().
+  virtual unsigned int numberVelocityDof() const;
+
   /// \brief Set the joint ordering in the configuration vector
   ///
   /// \param inJointVector Vector of the robot joints
@@ -150,13 +292,53 @@ public:
   /// \return the configuration vector \f${\bf q}\f$.
   virtual const vectorN& currentConfiguration() const = 0;
 
+  /// \brief Get the version of the current configuration.
+  ///
+  /// The version is incremented by each successful call to
+  /// computeForwardKinematics(), that updates the joint
+  /// transformations from the configuration. Setting the configuration
+  /// by currentConfiguration(const vectorN&) does not change the
+  /// version until forward kinematics is computed. Values computed from
+  /// the joint transformations and cached by the implementation, like
+  /// the joint jacobians (see CjrlJoint::updateJacobianJointWrtConfig),
+  /// are tagged with the version they have been computed for.
+  ///
+  /// \return the configuration version, starting at 1, or 0 if the
+  /// implementation does not track configuration versions.
+  virtual unsigned long configurationVersion() const;
+
+  /// \brief Get the sines of the current configuration.
+  ///
+  /// An implementation may compute the sines and cosines of all the
+  /// angular degrees of freedom (rotation joints and orientation of
+  /// freeflyer joints) once per successful call to
+  /// currentConfiguration(const vectorN&), in a single loop over the
+  /// configuration. Forward kinematics, jacobians, inertia matrix and
+  /// inverse dynamics then share these values instead of computing
+  /// them again.
+  ///
+  /// \return a vector of size numberDof() where the entry of rank
+  /// \f$i\f$ is \f$\sin(q_i)\f$ if \f$q_i\f$ is an angle, and is
+  /// unspecified otherwise, or 0 if the implementation does not cache
+  /// trigonometric values. The vector is updated in place at each
+  /// configuration change.
+  virtual const vectorN* configurationSine() const;
+
+  /// \brief Get the cosines of the current configuration.
+  ///
+  /// \return a vector of size numberDof() where the entry of rank
+  /// \f$i\f$ is \f$\cos(q_i)\f$ if \f$q_i\f$ is an angle, or 0 if
+  /// the implementation does not cache trigonometric values.
+  ///
+  /// \sa configurationSine()
+  virtual const vectorN* configurationCosine() const;
+
   /// \brief Set the current velocity of the robot.
   ///
   /// \param inVelocity the velocity vector \f${\bf \dot{q}}\f$.
   ///
   /// \return true if success, false if failure (the dimension of the
-  /// input vector does not fit the number of degrees of freedom of the
-  /// robot).
+  /// input vector is not numberVelocityDof()).
   virtual bool currentVelocity(const vectorN& inVelocity) = 0;
 
   /// \brief Get the current velocity of the robot.
@@ -169,8 +351,7 @@ public:
   /// \param inAcceleration the acceleration vector \f${\bf \ddot{q}}\f$.
   ///
   /// \return true if success, false if failure (the dimension of the
-  /// input vector does not fit the number of degrees of freedom of the
-  /// robot).
+  /// input vector is not numberVelocityDof()).
   virtual bool currentAcceleration(const vectorN& inAcceleration) = 0;
 
   /// \brief Get the current acceleration of the robot.
@@ -195,11 +376,117 @@ public:
   /// mode, supposing no contact with the environments, and knowing
   /// given position, velocity and acceleration. This accessor only give
   /// a reference on the already-computed values.
+  ///
+  /// The torques include the contribution of the rotor inertia and of
+  /// the friction of each degree of freedom (see CjrlJoint::rotorInertia,
+  /// CjrlJoint::viscousFriction and CjrlJoint::coulombFriction).
   /// \return the torque vector \f${\bf \tau }\f$.
   virtual const vectorN& currentJointTorques() const = 0;
 
   /// \}
 
+  /// \name Operations on configurations
+  ///
+  /// Configurations are not added like vectors: the orientation of a
+  /// freeflyer joint lives on a sphere or is subject to singularities.
+  /// The default implementations of integrate() and difference()
+  /// apply the operators of each joint of jointVector() (see
+  /// CjrlJoint::integrate and CjrlJoint::difference), and fail if one
+  /// of them does. interpolate() integrates the difference of the
+  /// configurations over the interpolation parameter. The batch
+  /// versions return false by default. Configurations have
+  /// numberDof() rows and velocities numberVelocityDof() rows.
+  /// \{
+
+  /// \brief Integrate a velocity over a time step.
+  ///
+  /// \param inConfig start configuration \f${\bf q}\f$.
+  /// \param inVelocity velocity \f${\bf \dot{q}}\f$.
+  /// \param inTimeStep duration of the integration.
+  /// \retval outConfig configuration reached from inConfig at constant
+  /// velocity.
+  ///
+  /// \return false if not implemented or if the dimensions of the
+  /// vectors do not fit.
+  virtual bool integrate(const vectorN& inConfig,
+			 const vectorN& inVelocity,
+			 Scalar inTimeStep,
+			 vectorN& outConfig) const;
+
+  /// \brief Compute the velocity leading from a configuration to another.
+  ///
+  /// \param inConfig0 start configuration.
+  /// \param inConfig1 end configuration.
+  /// \retval outVelocity velocity that, integrated over a unit time
+  /// step from inConfig0, leads to inConfig1.
+  ///
+  /// \return false if not implemented or if the dimensions of the
+  /// vectors do not fit.
+  virtual bool difference(const vectorN& inConfig0,
+			  const vectorN& inConfig1,
+			  vectorN& outVelocity) const;
+
+  /// \brief Interpolate between two configurations.
+  ///
+  /// \param inConfig0 configuration for parameter 0.
+  /// \param inConfig1 configuration for parameter 1.
+  /// \param inParameter interpolation parameter, in [0,1].
+  /// \retval outConfig configuration along the geodesic from inConfig0
+  /// to inConfig1.
+  ///
+  /// \return false if not implemented or if the dimensions of the
+  /// vectors do not fit.
+  virtual bool interpolate(const vectorN& inConfig0,
+			   const vectorN& inConfig1,
+			   Scalar inParameter,
+			   vectorN& outConfig) const;
+
+  /// \brief Integrate a sequence of velocities.
+  ///
+  /// \param inConfigs start configurations, one per column.
+  /// \param inVelocities velocities, one per column.
+  /// \param inTimeStep duration of each integration.
+  /// \retval outConfigs configurations, one per column, such that
+  /// column \f$k\f$ is the integration of column \f$k\f$ of
+  /// inVelocities from column \f$k\f$ of inConfigs.
+  ///
+  /// Equivalent to calling integrate() on each column, with a single
+  /// virtual call for a whole trajectory.
+  ///
+  /// \return false if not implemented or if the dimensions of the
+  /// matrices do not fit.
+  virtual bool integrateBatch(const matrixNxP& inConfigs,
+			      const matrixNxP& inVelocities,
+			      Scalar inTimeStep,
+			      matrixNxP& outConfigs) const;
+
+  /// \brief Compute the velocities between sequences of configurations.
+  ///
+  /// Equivalent to calling difference() on each column of the
+  /// matrices.
+  ///
+  /// \return false if not implemented or if the dimensions of the
+  /// matrices do not fit.
+  virtual bool differenceBatch(const matrixNxP& inConfigs0,
+			       const matrixNxP& inConfigs1,
+			       matrixNxP& outVelocities) const;
+
+  /// \brief Sample the geodesic between two configurations.
+  ///
+  /// \param inConfig0 configuration for parameter 0.
+  /// \param inConfig1 configuration for parameter 1.
+  /// \param inParameters interpolation parameters, in [0,1].
+  /// \retval outConfigs interpolated configurations, one column per
+  /// parameter.
+  ///
+  /// \return false if not implemented or if the dimensions do not fit.
+  virtual bool interpolateBatch(const vectorN& inConfig0,
+				const vectorN& inConfig1,
+				const vectorN& inParameters,
+				matrixNxP& outConfigs) const;
+
+  /// \}
+
   /// \name Forward kinematics and dynamics
 
   /// \brief Compute forward kinematics.
@@ -237,7 +524,7 @@ public:
   virtual const vector3d& derivativeAngularMomentum() = 0;
 
   /// \brief Get the total mass of the robot
-  virtual double mass() const =0;
+  virtual Scalar mass() const =0;
 
   /// \}
 
@@ -267,6 +554,29 @@ public:
   virtual bool setProperty(std::string &,
 			   const std::string& );
 
+  /// \brief Function called before an allocation in real-time mode.
+  ///
+  /// \param inMethodName name of the method allocating memory.
+  /// \param inSize number of bytes allocated.
+  typedef void (*AllocationHook) (const char* inMethodName,
+				  std::size_t inSize);
+
+  /// \brief Enter real-time mode.
+  ///
+  /// \param inHook function called before any memory allocation by
+  /// the implementation until leaveRealTimeMode() is called. If 0,
+  /// allocations are not reported.
+  ///
+  /// \return false if the robot is not initialized or if the
+  /// implementation does not support real-time mode.
+  virtual bool enterRealTimeMode(AllocationHook inHook);
+
+  /// \brief Leave real-time mode.
+  virtual void leaveRealTimeMode();
+
+  /// \brief Whether the robot is in real-time mode.
+  virtual bool isRealTimeMode() const;
+
   /// \}
 
   /**
@@ -283,9 +593,14 @@ public:
      fictive freeflyer superposed with inStartJoint
 
      \return false if matrix has inadequate size. Number of columns
-     in matrix outJacobian must be at least numberDof() if
+     in matrix outJacobian must be at least numberVelocityDof() if
      inIncludeStartFreeFlyer = true.
-     It must be at least numberDof()-6 otherwise.
+     It must be at least numberVelocityDof()-6 otherwise. Column
+     \f$j\f$ corresponds to the velocity degree of freedom of rank
+     \f$j\f$ (see CjrlJoint::rankInVelocity).
+
+     \note The velocity of the control frame is expressed as specified
+     by MIXED_FRAME. See getJacobianInFrame() for other conventions.
   */
   virtual bool getJacobian(const CjrlJoint& inStartJoint,
 			   const CjrlJoint& inEndJoint,
@@ -312,17 +627,471 @@ public:
 				       unsigned int offset = 0,
 				       bool inIncludeStartFreeFlyer = true) = 0;
 
+  /// \brief Frame in which the velocity of a control frame is expressed
+  /// by a jacobian.
+  enum ReferenceFrame
+    {
+      /// Spatial velocity at the origin of the global frame, expressed
+      /// in the global frame.
+      GLOBAL_FRAME,
+      /// Linear velocity of the control frame origin and angular
+      /// velocity, expressed in the axes of the local frame of the
+      /// joint carrying the control frame.
+      LOCAL_FRAME,
+      /// Linear velocity of the control frame origin and angular
+      /// velocity, expressed in the axes of the global frame. This is
+      /// the convention of getJacobian().
+      MIXED_FRAME
+    };
+
+  /**
+     \brief Compute and get position and orientation jacobian expressed
+     in a given reference frame.
+
+     The change of frame is folded into the computation of each column,
+     which avoids multiplying the jacobian returned by getJacobian() by
+     a rotation matrix.
+
+     \param inStartJoint First joint in the chain of joints influencing
+     the jacobian.
+     \param inEndJoint Joint where the control frame is located.
+     \param inFrameLocalPosition Position of the control frame in inEndJoint
+     local frame.
+     \param inReferenceFrame Frame in which the velocity is expressed.
+     \retval outjacobian computed jacobian matrix.
+     \param offset is the rank of the column from where the jacobian is written.
+     \param inIncludeStartFreeFlyer Option to include the contribution of a
+     fictive freeflyer superposed with inStartJoint
+
+     \return false if matrix has inadequate size (see getJacobian()) or
+     if the implementation does not support the requested frame. By
+     default, only MIXED_FRAME is supported, through getJacobian().
+  */
+  virtual bool getJacobianInFrame(const CjrlJoint& inStartJoint,
+				  const CjrlJoint& inEndJoint,
+				  const vector3d& inFrameLocalPosition,
+				  ReferenceFrame inReferenceFrame,
+				  matrixNxP& outjacobian,
+				  unsigned int offset = 0,
+				  bool inIncludeStartFreeFlyer = true);
+
+  /// \brief Compute and get position jacobian expressed in a given
+  /// reference frame.
+  ///
+  /// See getJacobianInFrame(). By default, only MIXED_FRAME is
+  /// supported, through getPositionJacobian().
+  virtual bool getPositionJacobianInFrame(const CjrlJoint& inStartJoint,
+					  const CjrlJoint& inEndJoint,
+					  const vector3d& inFrameLocalPosition,
+					  ReferenceFrame inReferenceFrame,
+					  matrixNxP& outjacobian,
+					  unsigned int offset = 0,
+					  bool inIncludeStartFreeFlyer = true);
+
+  /// \brief Compute and get orientation jacobian expressed in a given
+  /// reference frame.
+  ///
+  /// See getJacobianInFrame(). GLOBAL_FRAME and MIXED_FRAME give the
+  /// same result. By default, only these frames are supported, through
+  /// getOrientationJacobian().
+  virtual bool getOrientationJacobianInFrame(const CjrlJoint& inStartJoint,
+					     const CjrlJoint& inEndJoint,
+					     ReferenceFrame inReferenceFrame,
+					     matrixNxP& outjacobian,
+					     unsigned int offset = 0,
+					     bool inIncludeStartFreeFlyer = true);
+
+  /**
+     \brief Compute position and orientation jacobian into caller
+     supplied memory.
+
+     Same as getJacobian(), except that the jacobian is written into
+     memory owned by the caller, for instance a block of the constraint
+     matrix of a solver. Element \f$(i,j)\f$ of the jacobian is written
+     at address
+     \code
+     outjacobian + (inRowOffset + i) * inRowStride + (offset + j) * inColumnStride
+     \endcode
+     so that row-major storage is obtained with inColumnStride = 1 and
+     column-major storage with inRowStride = 1.
+
+     These methods never resize nor allocate memory: the caller is
+     responsible for providing a large enough memory block.
+
+     \param inStartJoint First joint in the chain of joints influencing
+     the jacobian.
+     \param inEndJoint Joint where the control frame is located.
+     \param inFrameLocalPosition Position of the control frame in inEndJoint
+     local frame.
+     \retval outjacobian address of element (0,0) of the output block.
+     \param inRowStride distance between two consecutive rows.
+     \param inColumnStride distance between two consecutive columns.
+     \param inRowOffset is the rank of the row from where the jacobian is
+     written.
+     \param offset is the rank of the column from where the jacobian is written.
+     \param inIncludeStartFreeFlyer Option to include the contribution of a
+     fictive freeflyer superposed with inStartJoint
+
+     \return false if the implementation does not support strided
+     output.
+  */
+  virtual bool getJacobianStrided(const CjrlJoint& inStartJoint,
+				  const CjrlJoint& inEndJoint,
+				  const vector3d& inFrameLocalPosition,
+				  Scalar* outjacobian,
+				  unsigned int inRowStride,
+				  unsigned int inColumnStride,
+				  unsigned int inRowOffset = 0,
+				  unsigned int offset = 0,
+				  bool inIncludeStartFreeFlyer = true);
+
+  /// \brief Compute position jacobian into caller supplied memory.
+  ///
+  /// See getJacobianStrided() for the memory layout.
+  virtual bool getPositionJacobianStrided(const CjrlJoint& inStartJoint,
+					  const CjrlJoint& inEndJoint,
+					  const vector3d& inFrameLocalPosition,
+					  Scalar* outjacobian,
+					  unsigned int inRowStride,
+					  unsigned int inColumnStride,
+					  unsigned int inRowOffset = 0,
+					  unsigned int offset = 0,
+					  bool inIncludeStartFreeFlyer = true);
+
+  /// \brief Compute orientation jacobian into caller supplied memory.
+  ///
+  /// See getJacobianStrided() for the memory layout.
+  virtual bool getOrientationJacobianStrided(const CjrlJoint& inStartJoint,
+					     const CjrlJoint& inEndJoint,
+					     Scalar* outjacobian,
+					     unsigned int inRowStride,
+					     unsigned int inColumnStride,
+					     unsigned int inRowOffset = 0,
+					     unsigned int offset = 0,
+					     bool inIncludeStartFreeFlyer = true);
+
+  /// \brief Compute center of mass jacobian into caller supplied memory.
+  ///
+  /// See getJacobianStrided() for the memory layout.
+  virtual bool getJacobianCenterOfMassStrided(const CjrlJoint& inStartJoint,
+					      Scalar* outjacobian,
+					      unsigned int inRowStride,
+					      unsigned int inColumnStride,
+					      unsigned int inRowOffset = 0,
+					      unsigned int offset = 0,
+					      bool inIncludeStartFreeFlyer = true);
+
+  /**
+     \brief Compute and get position and orientation jacobian restricted
+     to the degrees of freedom that influence it.
+
+     Only the columns corresponding to the degrees of freedom of the
+     joints returned by jointsBetween() (and of the fictive freeflyer if
+     requested) are computed. Column \f$c\f$ of outjacobian is equal to
+     column outDofRanks[c] of the matrix returned by getJacobian() with
+     offset = 0, all other columns of which are zero.
+
+     \param inStartJoint First joint in the chain of joints influencing
+     the jacobian.
+     \param inEndJoint Joint where the control frame is located.
+     \param inFrameLocalPosition Position of the control frame in inEndJoint
+     local frame.
+     \retval outDofRanks increasing column ranks of the non-zero columns.
+     \retval outjacobian compact jacobian matrix of size
+     \f$6\times k\f$, where \f$k\f$ is the size of outDofRanks.
+     \param inIncludeStartFreeFlyer Option to include the contribution of a
+     fictive freeflyer superposed with inStartJoint
+
+     The outputs are resized if necessary. Reusing the same outputs
+     from one call to the next avoids any memory allocation.
+
+     \return false if the implementation does not support this
+     computation.
+  */
+  virtual bool
+  getSparseJacobian(const CjrlJoint& inStartJoint,
+		    const CjrlJoint& inEndJoint,
+		    const vector3d& inFrameLocalPosition,
+		    std::vector<unsigned int>& outDofRanks,
+		    matrixNxP& outjacobian,
+		    bool inIncludeStartFreeFlyer = true);
+
+  /// \brief Compute and get position jacobian restricted to the degrees
+  /// of freedom that influence it.
+  ///
+  /// See getSparseJacobian(). The compact jacobian has 3 rows.
+  virtual bool
+  getSparsePositionJacobian(const CjrlJoint& inStartJoint,
+			    const CjrlJoint& inEndJoint,
+			    const vector3d& inFrameLocalPosition,
+			    std::vector<unsigned int>& outDofRanks,
+			    matrixNxP& outjacobian,
+			    bool inIncludeStartFreeFlyer = true);
+
+  /// \brief Compute and get orientation jacobian restricted to the
+  /// degrees of freedom that influence it.
+  ///
+  /// See getSparseJacobian(). The compact jacobian has 3 rows.
+  virtual bool
+  getSparseOrientationJacobian(const CjrlJoint& inStartJoint,
+			       const CjrlJoint& inEndJoint,
+			       std::vector<unsigned int>& outDofRanks,
+			       matrixNxP& outjacobian,
+			       bool inIncludeStartFreeFlyer = true);
+
+  /// \brief Compute and get center of mass jacobian restricted to the
+  /// degrees of freedom that influence it.
+  ///
+  /// See getSparseJacobian(). The compact jacobian has 3 rows and
+  /// the supporting degrees of freedom are those of the joints
+  /// carrying a body of non-zero mass, and of their ancestors up to
+  /// inStartJoint.
+  virtual bool
+  getSparseJacobianCenterOfMass(const CjrlJoint& inStartJoint,
+				std::vector<unsigned int>& outDofRanks,
+				matrixNxP& outjacobian,
+				bool inIncludeStartFreeFlyer = true);
+
+  /**
+     \brief Compute the product of the position and orientation jacobian
+     by a vector without building the jacobian.
+
+     The product is computed by a recursion along the chain of joints
+     returned by jointsBetween(), in time linear with the length of the
+     chain and without memory allocation.
+
+     \param inStartJoint First joint in the chain of joints influencing
+     the jacobian.
+     \param inEndJoint Joint where the control frame is located.
+     \param inFrameLocalPosition Position of the control frame in inEndJoint
+     local frame.
+     \param inVector vector \f${\bf \dot{q}}\f$ of the size of a row of
+     the jacobian returned by getJacobian() with offset = 0.
+     \retval outVelocity linear velocity of the control frame origin and
+     angular velocity of the control frame, \f$J{\bf \dot{q}}\f$.
+     \param inIncludeStartFreeFlyer Option to include the contribution of a
+     fictive freeflyer superposed with inStartJoint
+
+     \return false if inVector has inadequate size or if the
+     implementation does not support this computation.
+  */
+  virtual bool
+  jacobianTimesVector(const CjrlJoint& inStartJoint,
+		      const CjrlJoint& inEndJoint,
+		      const vector3d& inFrameLocalPosition,
+		      const vectorN& inVector,
+		      CjrlRigidVelocity& outVelocity,
+		      bool inIncludeStartFreeFlyer = true);
+
+  /**
+     \brief Compute the product of the transpose of the position and
+     orientation jacobian by a force without building the jacobian.
+
+     The force \f$({\bf f}, {\bf \tau})\f$ applied at the control
+     frame origin is mapped to the degrees of freedom by
+     \f$J^T\f$. The result is added to outTorques so that the
+     contributions of several contacts can be accumulated. Only the
+     entries corresponding to the joints returned by jointsBetween()
+     are modified. As jacobianTimesVector(), the computation is a
+     recursion along the chain of joints without memory allocation.
+
+     \param inStartJoint First joint in the chain of joints influencing
+     the jacobian.
+     \param inEndJoint Joint where the control frame is located.
+     \param inFrameLocalPosition Position of the control frame in inEndJoint
+     local frame.
+     \param inForce force \f${\bf f}\f$ expressed in the global frame.
+     \param inTorque torque \f${\bf \tau}\f$ at the control frame origin
+     expressed in the global frame.
+     \retval outTorques vector of the size of a row of the jacobian
+     returned by getJacobian() with offset = 0, to which
+     \f$J^T({\bf f}, {\bf \tau})\f$ is added. It is never resized.
+     \param inIncludeStartFreeFlyer Option to include the contribution of a
+     fictive freeflyer superposed with inStartJoint
+
+     \return false if outTorques has inadequate size or if the
+     implementation does not support this computation.
+  */
+  virtual bool
+  jacobianTransposeTimesForce(const CjrlJoint& inStartJoint,
+			      const CjrlJoint& inEndJoint,
+			      const vector3d& inFrameLocalPosition,
+			      const vector3d& inForce,
+			      const vector3d& inTorque,
+			      vectorN& outTorques,
+			      bool inIncludeStartFreeFlyer = true);
+
+  /// \brief Get the statistics of the joint jacobian cache.
+  ///
+  /// \retval outHits number of calls to
+  /// CjrlJoint::updateJacobianJointWrtConfig that returned the cached
+  /// jacobian.
+  /// \retval outMisses number of calls to
+  /// CjrlJoint::updateJacobianJointWrtConfig that computed the jacobian.
+  ///
+  /// \return false if the implementation does not count cache accesses.
+  virtual bool jacobianCacheStatistics(unsigned long& outHits,
+				       unsigned long& outMisses) const;
+
+  /// \brief Reset the statistics of the joint jacobian cache.
+  virtual void resetJacobianCacheStatistics();
+
+  /**
+     \brief Compute and get the position and orientation jacobians of
+     several control frames in a single pass.
+
+     The jacobian of control frame \f$k\f$, as returned by
+     getJacobian(), is written in rows \f$6k\f$ to \f$6k+5\f$ of
+     outjacobian. The chains of joints leading to each control frame
+     are traversed once and the columns corresponding to common
+     ancestors are computed only once.
+
+     \param inStartJoint First joint in the chains of joints influencing
+     the jacobians.
+     \param inEndJoints Joints where the control frames are located.
+     \param inFrameLocalPositions Position of each control frame in the
+     local frame of the corresponding joint of inEndJoints.
+     \retval outjacobian stacked jacobian matrices.
+     \param offset is the rank of the column from where the jacobians are
+     written.
+     \param inIncludeStartFreeFlyer Option to include the contribution of a
+     fictive freeflyer superposed with inStartJoint
+
+     \return false if inEndJoints and inFrameLocalPositions have
+     different sizes, if matrix has inadequate size or if the
+     implementation does not support this computation. Matrix
+     outjacobian must have at least 6 rows per control frame, its
+     number of columns follows the rules of getJacobian().
+  */
+  virtual bool
+  getStackedJacobian(const CjrlJoint& inStartJoint,
+		     const std::vector<const CjrlJoint*>& inEndJoints,
+		     const std::vector<vector3d>& inFrameLocalPositions,
+		     matrixNxP& outjacobian,
+		     unsigned int offset = 0,
+		     bool inIncludeStartFreeFlyer = true);
+
+  /**
+     \brief Compute and get the time derivative of the position and
+     orientation jacobian.
+
+     The derivative \f$\dot{J}({\bf q},{\bf \dot{q}})\f$ of the
+     jacobian returned by getJacobian() is computed from the joint
+     velocities updated by the last call to computeForwardKinematics().
+
+     \param inStartJoint First joint in the chain of joints influencing
+     the jacobian.
+     \param inEndJoint Joint where the control frame is located.
+     \param inFrameLocalPosition Position of the control frame in inEndJoint
+     local frame.
+     \retval outjacobianDerivative computed time derivative of the
+     jacobian matrix.
+     \param offset is the rank of the column from where the derivative
+     is written.
+     \param inIncludeStartFreeFlyer Option to include the contribution of a
+     fictive freeflyer superposed with inStartJoint
+
+     \return false if matrix has inadequate size (see getJacobian()) or
+     if the implementation does not support this computation.
+  */
+  virtual bool
+  getJacobianTimeDerivative(const CjrlJoint& inStartJoint,
+			    const CjrlJoint& inEndJoint,
+			    const vector3d& inFrameLocalPosition,
+			    matrixNxP& outjacobianDerivative,
+			    unsigned int offset = 0,
+			    bool inIncludeStartFreeFlyer = true);
+
+  /**
+     \brief Get the drift acceleration \f$\dot{J}{\bf \dot{q}}\f$ of a
+     frame attached to a joint.
+
+     The drift acceleration is the acceleration of the frame when
+     \f${\bf \ddot{q}} = 0\f$. The joint accelerations updated by
+     computeForwardKinematics() include the contribution of the
+     current acceleration \f${\bf \ddot{q}}\f$, and equal the drift
+     only if it is 0. The implementation thus recomputes the
+     accelerations along the chain of inJoint with \f${\bf \ddot{q}}
+     = 0\f$, from the joint placements and velocities updated by the
+     last call to computeForwardKinematics(), or subtracts
+     \f$J{\bf \ddot{q}}\f$ from the acceleration of the frame. In
+     both cases \f$\dot{J}\f$ is not built, which is much cheaper
+     than getJacobianTimeDerivative() followed by a product with
+     \f${\bf \dot{q}}\f$.
+
+     \param inJoint Joint where the frame is located.
+     \param inFrameLocalPosition Position of the frame in inJoint local
+     frame.
+     \retval outDriftAcceleration linear acceleration of the frame origin
+     and angular acceleration of the frame, expressed in the global
+     frame.
+
+     \return false if the implementation does not support this
+     computation.
+  */
+  virtual bool
+  getFrameDriftAcceleration(const CjrlJoint& inJoint,
+			    const vector3d& inFrameLocalPosition,
+			    CjrlRigidAcceleration& outDriftAcceleration);
+
   ///\name Inertia matrix related methods
   /// \{
 
   /// \brief Compute the inertia matrix of the robot according wrt
   /// \f${\bf q}\f$.
+  ///
+  /// The rotor inertia of each degree of freedom (see
+  /// CjrlJoint::rotorInertia) is added to the corresponding diagonal
+  /// term during the computation.
   virtual void computeInertiaMatrix() = 0;
 
   /// \brief Get the inertia matrix of the robot according wrt \f${\bf q}\f$.
   virtual const matrixNxP& inertiaMatrix() const = 0;
   /// \}
 
+  /// \name Asynchronous computations
+  ///
+  /// The following methods start a computation in the background and
+  /// return immediately. The computation uses the configuration,
+  /// velocity and acceleration of the robot at the time of the call:
+  /// they can be changed, and the robot used, during the computation.
+  /// The model must not be modified until the end of the computation:
+  /// the kinematic chain, the joints, the bodies and their properties
+  /// are read by the computation, as by a CjrlDynamicRobotData.
+  ///
+  /// The result is written into the output argument, that must exist
+  /// and not be accessed until the returned handle reports the end of
+  /// the computation (see CjrlAsyncComputation). The handle must be
+  /// waited on and deleted before the robot is destroyed.
+  /// \{
+
+  /// \brief Start the computation of the inertia matrix.
+  ///
+  /// \retval outInertiaMatrix inertia matrix, as computed by
+  /// computeInertiaMatrix(), of size numberVelocityDof().
+  ///
+  /// \return a handle on the computation to be deleted by the caller,
+  /// or 0 if not implemented.
+  virtual CjrlAsyncComputation*
+  computeInertiaMatrixAsync(matrixNxP& outInertiaMatrix);
+
+  /// \brief Start the computation of stacked jacobians.
+  ///
+  /// Same arguments as getStackedJacobian(). The vectors of joints and
+  /// positions are copied.
+  ///
+  /// \return a handle on the computation to be deleted by the caller,
+  /// or 0 if not implemented.
+  virtual CjrlAsyncComputation*
+  getStackedJacobianAsync(const CjrlJoint& inStartJoint,
+			  const std::vector<const CjrlJoint*>& inEndJoints,
+			  const std::vector<vector3d>& inFrameLocalPositions,
+			  matrixNxP& outjacobian,
+			  unsigned int offset = 0,
+			  bool inIncludeStartFreeFlyer = true);
+
+  /// \}
+
   /// \name Actuated joints related methods.
   /// \{
 
@@ -376,30 +1145,440 @@ public:
 // interface in an efficient way. A good compromise is class
 // declaration with no implementation and parameters with name, then
 // implementation where unused parameters have no name.
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::getProperty(const std::string&, std::string&) const
+{
+  return false;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::setProperty(std::string&, const std::string&)
+{
+  return false;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::isSupported(const std::string&)
+{
+  return false;
+}
+
+template <typename Scalar>
+inline typename CjrlDynamicRobotTpl<Scalar>::CjrlDynamicRobotData*
+CjrlDynamicRobotTpl<Scalar>::createData() const
+{
+  return 0;
+}
+
+template <typename Scalar>
+inline CjrlAsyncComputation*
+CjrlDynamicRobotTpl<Scalar>::computeInertiaMatrixAsync(matrixNxP&)
+{
+  return 0;
+}
+
+template <typename Scalar>
+inline CjrlAsyncComputation*
+CjrlDynamicRobotTpl<Scalar>::getStackedJacobianAsync(const CjrlJoint&,
+						     const std::vector<const CjrlJoint*>&,
+						     const std::vector<vector3d>&,
+						     matrixNxP&,
+						     unsigned int,
+						     bool)
+{
+  return 0;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::enterRealTimeMode(AllocationHook)
+{
+  return false;
+}
+
+template <typename Scalar>
+inline void
+CjrlDynamicRobotTpl<Scalar>::leaveRealTimeMode()
+{
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::isRealTimeMode() const
+{
+  return false;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::publishState()
+{
+  return false;
+}
+
+template <typename Scalar>
+inline const typename CjrlDynamicRobotTpl<Scalar>::CjrlDynamicRobotData*
+CjrlDynamicRobotTpl<Scalar>::acquirePublishedState() const
+{
+  return 0;
+}
+
+template <typename Scalar>
+inline void
+CjrlDynamicRobotTpl<Scalar>::releasePublishedState(const CjrlDynamicRobotData*) const
+{
+}
+
+template <typename Scalar>
+inline CjrlDynamicRobotTpl<Scalar>*
+CjrlDynamicRobotTpl<Scalar>::clone() const
+{
+  return 0;
+}
+
+template <typename Scalar>
+inline unsigned int
+CjrlDynamicRobotTpl<Scalar>::numberVelocityDof() const
+{
+  return numberDof();
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::integrate(const vectorN& inConfig,
+				       const vectorN& inVelocity,
+				       Scalar inTimeStep,
+				       vectorN& outConfig) const
+{
+  if (inConfig.size() != numberDof()
+      || inVelocity.size() != numberVelocityDof()
+      || outConfig.size() != numberDof())
+    return false;
+
+  // jointVector() does not modify the robot but is not const.
+  const std::vector<CjrlJoint*> joints =
+    const_cast<CjrlDynamicRobotTpl*>(this)->jointVector();
+  for (unsigned int i = 0; i < joints.size(); ++i)
+    if (joints[i]->numberDof() != 0
+	&& !joints[i]->integrate(inConfig, inVelocity, inTimeStep, outConfig))
+      return false;
+  return true;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::difference(const vectorN& inConfig0,
+					const vectorN& inConfig1,
+					vectorN& outVelocity) const
+{
+  if (inConfig0.size() != numberDof()
+      || inConfig1.size() != numberDof()
+      || outVelocity.size() != numberVelocityDof())
+    return false;
+
+  // jointVector() does not modify the robot but is not const.
+  const std::vector<CjrlJoint*> joints =
+    const_cast<CjrlDynamicRobotTpl*>(this)->jointVector();
+  for (unsigned int i = 0; i < joints.size(); ++i)
+    if (joints[i]->numberDof() != 0
+	&& !joints[i]->difference(inConfig0, inConfig1, outVelocity))
+      return false;
+  return true;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::interpolate(const vectorN& inConfig0,
+					 const vectorN& inConfig1,
+					 Scalar inParameter,
+					 vectorN& outConfig) const
+{
+  vectorN velocity(numberVelocityDof());
+  return difference(inConfig0, inConfig1, velocity)
+    && integrate(inConfig0, velocity, inParameter, outConfig);
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::integrateBatch(const matrixNxP&,
+					    const matrixNxP&,
+					    Scalar,
+					    matrixNxP&) const
+{
+  return false;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::differenceBatch(const matrixNxP&,
+					     const matrixNxP&,
+					     matrixNxP&) const
+{
+  return false;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::interpolateBatch(const vectorN&,
+					      const vectorN&,
+					      const vectorN&,
+					      matrixNxP&) const
+{
+  return false;
+}
+
+template <typename Scalar>
+inline unsigned long
+CjrlDynamicRobotTpl<Scalar>::configurationVersion() const
+{
+  return 0;
+}
+
+template <typename Scalar>
+inline const typename CjrlDynamicRobotTpl<Scalar>::vectorN*
+CjrlDynamicRobotTpl<Scalar>::configurationSine() const
+{
+  return 0;
+}
+
+template <typename Scalar>
+inline const typename CjrlDynamicRobotTpl<Scalar>::vectorN*
+CjrlDynamicRobotTpl<Scalar>::configurationCosine() const
+{
+  return 0;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::jacobianCacheStatistics(unsigned long&,
+						     unsigned long&) const
+{
+  return false;
+}
+
+template <typename Scalar>
+inline void
+CjrlDynamicRobotTpl<Scalar>::resetJacobianCacheStatistics()
+{
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::getJacobianInFrame(const CjrlJoint& inStartJoint,
+						const CjrlJoint& inEndJoint,
+						const vector3d& inFrameLocalPosition,
+						ReferenceFrame inReferenceFrame,
+						matrixNxP& outjacobian,
+						unsigned int offset,
+						bool inIncludeStartFreeFlyer)
+{
+  if (inReferenceFrame != MIXED_FRAME)
+    return false;
+  return getJacobian(inStartJoint, inEndJoint, inFrameLocalPosition,
+		     outjacobian, offset, inIncludeStartFreeFlyer);
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::getPositionJacobianInFrame(const CjrlJoint& inStartJoint,
+							const CjrlJoint& inEndJoint,
+							const vector3d& inFrameLocalPosition,
+							ReferenceFrame inReferenceFrame,
+							matrixNxP& outjacobian,
+							unsigned int offset,
+							bool inIncludeStartFreeFlyer)
+{
+  if (inReferenceFrame != MIXED_FRAME)
+    return false;
+  return getPositionJacobian(inStartJoint, inEndJoint, inFrameLocalPosition,
+			     outjacobian, offset, inIncludeStartFreeFlyer);
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::getOrientationJacobianInFrame(const CjrlJoint& inStartJoint,
+							   const CjrlJoint& inEndJoint,
+							   ReferenceFrame inReferenceFrame,
+							   matrixNxP& outjacobian,
+							   unsigned int offset,
+							   bool inIncludeStartFreeFlyer)
+{
+  if (inReferenceFrame == LOCAL_FRAME)
+    return false;
+  return getOrientationJacobian(inStartJoint, inEndJoint,
+				outjacobian, offset, inIncludeStartFreeFlyer);
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::getJacobianStrided(const CjrlJoint&,
+						const CjrlJoint&,
+						const vector3d&,
+						Scalar*,
+						unsigned int,
+						unsigned int,
+						unsigned int,
+						unsigned int,
+						bool)
+{
+  return false;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::getPositionJacobianStrided(const CjrlJoint&,
+							const CjrlJoint&,
+							const vector3d&,
+							Scalar*,
+							unsigned int,
+							unsigned int,
+							unsigned int,
+							unsigned int,
+							bool)
+{
+  return false;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::getOrientationJacobianStrided(const CjrlJoint&,
+							   const CjrlJoint&,
+							   Scalar*,
+							   unsigned int,
+							   unsigned int,
+							   unsigned int,
+							   unsigned int,
+							   bool)
+{
+  return false;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::getJacobianCenterOfMassStrided(const CjrlJoint&,
+							    Scalar*,
+							    unsigned int,
+							    unsigned int,
+							    unsigned int,
+							    unsigned int,
+							    bool)
+{
+  return false;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::getSparseJacobian(const CjrlJoint&,
+					       const CjrlJoint&,
+					       const vector3d&,
+					       std::vector<unsigned int>&,
+					       matrixNxP&,
+					       bool)
+{
+  return false;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::getSparsePositionJacobian(const CjrlJoint&,
+						       const CjrlJoint&,
+						       const vector3d&,
+						       std::vector<unsigned int>&,
+						       matrixNxP&,
+						       bool)
+{
+  return false;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::getSparseOrientationJacobian(const CjrlJoint&,
+							  const CjrlJoint&,
+							  std::vector<unsigned int>&,
+							  matrixNxP&,
+							  bool)
+{
+  return false;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::getSparseJacobianCenterOfMass(const CjrlJoint&,
+							   std::vector<unsigned int>&,
+							   matrixNxP&,
+							   bool)
+{
+  return false;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::jacobianTimesVector(const CjrlJoint&,
+						 const CjrlJoint&,
+						 const vector3d&,
+						 const vectorN&,
+						 CjrlRigidVelocity&,
+						 bool)
+{
+  return false;
+}
+
+template <typename Scalar>
+inline bool
+CjrlDynamicRobotTpl<Scalar>::jacobianTransposeTimesForce(const CjrlJoint&,
+							 const CjrlJoint&,
+							 const vector3d&,
+							 const vector3d&,
+							 const vector3d&,
+							 vectorN&,
+							 bool)
+{
+  return false;
+}
+
+template <typename Scalar>
 inline bool
-CjrlDynamicRobot::getProperty(const std::string&, std::string&) const
+CjrlDynamicRobotTpl<Scalar>::getStackedJacobian(const CjrlJoint&,
+						const std::vector<const CjrlJoint*>&,
+						const std::vector<vector3d>&,
+						matrixNxP&,
+						unsigned int,
+						bool)
 {
   return false;
 }
 
+template <typename Scalar>
 inline bool
-CjrlDynamicRobot::setProperty(std::string&, const std::string&)
+CjrlDynamicRobotTpl<Scalar>::getJacobianTimeDerivative(const CjrlJoint&,
+						       const CjrlJoint&,
+						       const vector3d&,
+						       matrixNxP&,
+						       unsigned int,
+						       bool)
 {
   return false;
 }
 
+template <typename Scalar>
 inline bool
-CjrlDynamicRobot::isSupported(const std::string&)
+CjrlDynamicRobotTpl<Scalar>::getFrameDriftAcceleration(const CjrlJoint&,
+						       const vector3d&,
+						       CjrlRigidAcceleration&)
 {
   return false;
 }
 
+template <typename Scalar>
 inline bool
-CjrlDynamicRobot::getSpecializedInverseKinematics(const CjrlJoint&,
-						  const CjrlJoint&,
-						  const matrix4d&,
-						  const matrix4d&,
-						  vectorN&)
+CjrlDynamicRobotTpl<Scalar>::getSpecializedInverseKinematics(const CjrlJoint&,
+							     const CjrlJoint&,
+							     const matrix4d&,
+							     const matrix4d&,
+							     vectorN&)
 {
   return false;
 }
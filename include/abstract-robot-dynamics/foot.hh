@@ -39,6 +39,8 @@
 class CjrlFoot
 {
 public:
+  typedef CjrlScalarTraits<double>::vector3d vector3d;
+
   /// \brief Destructor
   virtual ~CjrlFoot() {}
 
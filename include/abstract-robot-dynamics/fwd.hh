@@ -17,10 +17,33 @@
 #ifndef ABSTRACT_ROBOT_DYNAMICS_FWD_HH
 # define ABSTRACT_ROBOT_DYNAMICS_FWD_HH
 
-class CjrlJoint;
-class CjrlBody;
+template <typename Scalar> struct CjrlScalarTraits;
+template <typename Scalar> class CjrlJointTpl;
+template <typename Scalar> class CjrlBodyTpl;
+template <typename Scalar> class CjrlDynamicRobotTpl;
+template <typename Scalar> class CjrlDynamicRobotDataTpl;
+template <typename Scalar> class CjrlRigidVelocityTpl;
+template <typename Scalar> class CjrlRigidAccelerationTpl;
+template <typename Scalar> class CjrlSpatialMotionTpl;
+template <typename Scalar> class CjrlSpatialForceTpl;
+template <typename Scalar> class CjrlSpatialInertiaTpl;
+template <typename Scalar> class CjrlRigidTransformationTpl;
+template <typename Scalar> class CjrlBatchEvaluatorTpl;
+
+typedef CjrlJointTpl<double> CjrlJoint;
+typedef CjrlBodyTpl<double> CjrlBody;
+typedef CjrlDynamicRobotTpl<double> CjrlDynamicRobot;
+typedef CjrlDynamicRobotDataTpl<double> CjrlDynamicRobotData;
+typedef CjrlRigidVelocityTpl<double> CjrlRigidVelocity;
+typedef CjrlRigidAccelerationTpl<double> CjrlRigidAcceleration;
+typedef CjrlSpatialMotionTpl<double> CjrlSpatialMotion;
+typedef CjrlSpatialForceTpl<double> CjrlSpatialForce;
+typedef CjrlSpatialInertiaTpl<double> CjrlSpatialInertia;
+typedef CjrlRigidTransformationTpl<double> CjrlRigidTransformation;
+typedef CjrlBatchEvaluatorTpl<double> CjrlBatchEvaluator;
+
+class CjrlAsyncComputation;
 class CjrlFoot;
 class CjrlHand;
-class CjrlDynamicRobot;
 
 #endif //! ABSTRACT_ROBOT_DYNAMICS_FWD_HH
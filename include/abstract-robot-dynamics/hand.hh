@@ -29,6 +29,8 @@
 class CjrlHand
 {
 public:
+  typedef CjrlScalarTraits<double>::vector3d vector3d;
+
   /// \brief Destructor.
   virtual ~CjrlHand() {}
 
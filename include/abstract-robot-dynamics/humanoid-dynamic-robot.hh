@@ -46,6 +46,20 @@ public:
   /// \brief Destructor.
   virtual ~CjrlHumanoidDynamicRobot() {}
 
+  /// \brief Construct and return a pointer to a copy of the robot.
+  ///
+  /// In addition to the copy made by CjrlDynamicRobot::clone(), the
+  /// joints specific to humanoid robots, the hands and the feet of the
+  /// copy refer to the corresponding objects of the copy. Ownership of
+  /// the copy is the same as for CjrlDynamicRobot::clone().
+  ///
+  /// This method is not named clone(), so that implementations
+  /// overriding CjrlDynamicRobot::clone() in a class shared with non
+  /// humanoid robots still have a unique final overrider.
+  ///
+  /// \return 0 if not implemented.
+  virtual CjrlHumanoidDynamicRobot* cloneHumanoid() const;
+
   /// \name Joints specific to humanoid robots
   /// \{
 
@@ -157,4 +171,10 @@ public:
   /// \}
 };
 
+inline CjrlHumanoidDynamicRobot*
+CjrlHumanoidDynamicRobot::cloneHumanoid() const
+{
+  return 0;
+}
+
 #endif //! ABSTRACT_ROBOT_DYNAMICS_HUMANOID_DYNAMIC_ROBOT_HH
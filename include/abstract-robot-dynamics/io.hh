@@ -16,5 +16,221 @@
 
 #ifndef ABSTRACT_ROBOT_DYNAMICS_IO_HH
 # define ABSTRACT_ROBOT_DYNAMICS_IO_HH
+# include <stdint.h>
+
+# include <abstract-robot-dynamics/fwd.hh>
+
+/**
+   \page abstractRobotDynamics_modelFormat Binary model format
+
+   A robot model (kinematic chain, initial positions, bodies, bounds,
+   hands, feet and joint names) can be saved into a binary file by
+   CjrlRobotDynamicsObjectFactory::saveModel() and loaded by
+   CjrlRobotDynamicsObjectFactory::loadDynamicRobot() and
+   CjrlRobotDynamicsObjectFactory::loadHumanoidDynamicRobot().
+
+   The file is designed to be mapped in memory and used in place:
+   \li it starts with a CjrlModelFileHeader giving the position of
+   each section,
+   \li sections are arrays of fixed size records, aligned on 8 bytes,
+   \li integers and floating point numbers are stored in little endian
+   order, floating point numbers as IEEE 754 double precision,
+   \li references between records are indices in the corresponding
+   section, -1 meaning none,
+   \li names are null-terminated strings stored in the names section,
+   referenced by their offset in this section,
+   \li records have no implicit padding, explicit padding fields are
+   written as 0.
+
+   Joints are stored in the order of the configuration vector, a
+   parent before its children. Several processes loading the same file
+   thus share its pages, and a loader only has to check the header
+   before using the records.
+
+   The format is versioned by CjrlModelFileHeader::version. Loaders
+   must reject files with a version they do not know.
+*/
+
+/// \brief Version of the binary model format written by this package.
+# define ABSTRACT_ROBOT_DYNAMICS_MODEL_FORMAT_VERSION 1
+
+/// \brief Type of a joint in the binary model format.
+enum CjrlModelFileJointType
+  {
+    /// Joint created by CjrlRobotDynamicsObjectFactory::createJointAnchor().
+    CJRL_MODEL_FILE_ANCHOR = 0,
+    /// Joint created by
+    /// CjrlRobotDynamicsObjectFactory::createJointFreeflyer().
+    CJRL_MODEL_FILE_FREEFLYER = 1,
+    /// Joint created by
+    /// CjrlRobotDynamicsObjectFactory::createJointRotation().
+    CJRL_MODEL_FILE_ROTATION = 2,
+    /// Joint created by
+    /// CjrlRobotDynamicsObjectFactory::createJointTranslation().
+    CJRL_MODEL_FILE_TRANSLATION = 3,
+    /// Joint created by
+    /// CjrlRobotDynamicsObjectFactory::createJointQuaternionFreeflyer().
+    CJRL_MODEL_FILE_QUATERNION_FREEFLYER = 4
+  };
+
+/// \brief Position and number of records of a section.
+struct CjrlModelFileSection
+{
+  /// \brief Offset of the section from the beginning of the file.
+  uint64_t offset;
+  /// \brief Number of records, or of bytes for the names section.
+  uint64_t count;
+};
+
+/// \brief Joints and devices specific to humanoid robots.
+///
+/// Joint fields are indices in the joints section, hand and foot
+/// fields are indices in the hands and feet sections.
+struct CjrlModelFileHumanoid
+{
+  int32_t waist;
+  int32_t chest;
+  int32_t leftWrist;
+  int32_t rightWrist;
+  int32_t leftAnkle;
+  int32_t rightAnkle;
+  int32_t gazeJoint;
+  int32_t leftHand;
+  int32_t rightHand;
+  int32_t leftFoot;
+  int32_t rightFoot;
+  uint32_t padding;
+  double gazeOrigin[3];
+  double gazeDirection[3];
+};
+
+/// \brief Header of a binary model file.
+struct CjrlModelFileHeader
+{
+  /// \brief Bits of flags.
+  enum Flag
+    {
+      /// Set for a humanoid robot.
+      HUMANOID = 1
+    };
+
+  /// \brief Characters 'A', 'R', 'D', 'M'.
+  char magic[4];
+  /// \brief Version of the format.
+  uint32_t version;
+  /// \brief Size of floating point numbers, 8.
+  uint32_t scalarSize;
+  /// \brief Combination of values of Flag.
+  uint32_t flags;
+  /// \brief Size of the file in bytes.
+  uint64_t fileSize;
+
+  /// \brief Section of CjrlModelFileJoint records.
+  CjrlModelFileSection joints;
+  /// \brief Section of CjrlModelFileConfigurationDof records, one per
+  /// configuration variable, in the order of the configuration vector.
+  CjrlModelFileSection configurationDofs;
+  /// \brief Section of CjrlModelFileVelocityDof records, one per
+  /// velocity degree of freedom, in the order of the velocity vector.
+  CjrlModelFileSection velocityDofs;
+  /// \brief Section of CjrlModelFileBody records.
+  CjrlModelFileSection bodies;
+  /// \brief Section of CjrlModelFileHand records.
+  CjrlModelFileSection hands;
+  /// \brief Section of CjrlModelFileFoot records.
+  CjrlModelFileSection feet;
+  /// \brief Section of null-terminated names.
+  CjrlModelFileSection names;
+
+  /// \brief Humanoid data, meaningful if flags contains HUMANOID.
+  CjrlModelFileHumanoid humanoid;
+};
+
+/// \brief Joint record.
+struct CjrlModelFileJoint
+{
+  /// \brief Value of CjrlModelFileJointType.
+  uint32_t type;
+  /// \brief Index of the parent joint.
+  int32_t parent;
+  /// \brief Offset of the name in the names section.
+  uint32_t name;
+  /// \brief Index of the linked body.
+  int32_t body;
+  /// \sa CjrlJoint::rankInConfiguration()
+  uint32_t rankInConfiguration;
+  /// \sa CjrlJoint::numberDof()
+  uint32_t numberDof;
+  /// \sa CjrlJoint::rankInVelocity()
+  uint32_t rankInVelocity;
+  /// \sa CjrlJoint::numberVelocityDof()
+  uint32_t numberVelocityDof;
+  /// \brief Initial position: rotation matrix row by row, then
+  /// translation.
+  double initialPosition[12];
+};
+
+/// \brief Bounds of a configuration variable.
+///
+/// The record of rank \f$i\f$ describes the configuration variable of
+/// rank \f$i\f$ (see CjrlJoint::rankInConfiguration).
+struct CjrlModelFileConfigurationDof
+{
+  double lowerBound;
+  double upperBound;
+};
+
+/// \brief Bounds and actuator parameters of a velocity degree of
+/// freedom.
+///
+/// The record of rank \f$i\f$ describes the velocity degree of
+/// freedom of rank \f$i\f$ (see CjrlJoint::rankInVelocity). A
+/// quaternion freeflyer joint thus has 7 configuration records and 6
+/// velocity records.
+struct CjrlModelFileVelocityDof
+{
+  double lowerVelocityBound;
+  double upperVelocityBound;
+  double lowerTorqueBound;
+  double upperTorqueBound;
+  double rotorInertia;
+  double viscousFriction;
+  double coulombFriction;
+};
+
+/// \brief Body record.
+struct CjrlModelFileBody
+{
+  double mass;
+  double localCenterOfMass[3];
+  /// \brief Inertia matrix, row by row.
+  double inertiaMatrix[9];
+  /// \brief Index of the joint the body is linked to.
+  int32_t joint;
+  uint32_t padding;
+};
+
+/// \brief Hand record.
+struct CjrlModelFileHand
+{
+  /// \brief Index of the wrist joint.
+  int32_t wrist;
+  uint32_t padding;
+  double center[3];
+  double thumbAxis[3];
+  double foreFingerAxis[3];
+  double palmNormal[3];
+};
+
+/// \brief Foot record.
+struct CjrlModelFileFoot
+{
+  /// \brief Index of the ankle joint.
+  int32_t ankle;
+  uint32_t padding;
+  double soleLength;
+  double soleWidth;
+  double anklePositionInLocalFrame[3];
+};
 
 #endif //! ABSTRACT_ROBOT_DYNAMICS_IO_HH
@@ -20,9 +20,11 @@
 # include <string>
 
 # include <abstract-robot-dynamics/fwd.hh>
+# include <abstract-robot-dynamics/scalar-traits.hh>
 # include <abstract-robot-dynamics/rigid-acceleration.hh>
 # include <abstract-robot-dynamics/rigid-velocity.hh>
 # include <abstract-robot-dynamics/body.hh>
+# include <abstract-robot-dynamics/spatial-algebra.hh>
 
 
 /**
@@ -40,11 +42,25 @@
    \li CjrlJoint::currentTransformation returns the current position
    of the joint.
 
-   Three types of joints are considered and defined as follows.
+   The same transformations are also available as
+   CjrlRigidTransformation objects, that store a rotation matrix and a
+   translation vector only, through CjrlJoint::initialPlacement and
+   CjrlJoint::currentPlacement. By default, they are converted from
+   the homogeneous matrices. Implementations storing and composing
+   transformations in this form should override them.
+
+   Four types of joints are considered and defined as follows.
 
    \li Freeflyer joint has 6 degrees of freedom. In identity initial
    position, the degrees of freedom respectively correspond to
    translation along x,y,z and roll, pitch, yaw angles.
+   \li Quaternion freeflyer joint has 7 configuration variables and 6
+   velocity degrees of freedom. The configuration variables are
+   \f$(x, y, z, q_x, q_y, q_z, q_w)\f$: the translation followed by a
+   unit quaternion, the identity rotation being \f$(0, 0, 0, 1)\f$.
+   The velocity variables are the linear and angular velocities of
+   the joint frame, expressed in the joint frame. Unlike the roll,
+   pitch, yaw parameterization, this joint has no singularity.
    \li Rotation joint has 1 degree of freedom. In identity initial
    position, the joint rotates about x-axis.
    \li Translation joint has 1 degree of freedom. In identity initial
@@ -70,13 +86,31 @@
    \f[
    M_{cur}({\bf q}).M_{init}^{-1}.{\bf p}
    \f]
+
+   CjrlJoint is the instantiation for double.
 */
 
-class CjrlJoint
+template <typename Scalar>
+class CjrlJointTpl
 {
 public:
+  /// \name Types for the scalar type
+  /// \{
+
+  typedef typename CjrlScalarTraits<Scalar>::vector3d vector3d;
+  typedef typename CjrlScalarTraits<Scalar>::matrix4d matrix4d;
+  typedef typename CjrlScalarTraits<Scalar>::vectorN vectorN;
+  typedef typename CjrlScalarTraits<Scalar>::matrixNxP matrixNxP;
+  typedef CjrlJointTpl<Scalar> CjrlJoint;
+  typedef CjrlBodyTpl<Scalar> CjrlBody;
+  typedef CjrlRigidVelocityTpl<Scalar> CjrlRigidVelocity;
+  typedef CjrlRigidAccelerationTpl<Scalar> CjrlRigidAcceleration;
+  typedef CjrlRigidTransformationTpl<Scalar> CjrlRigidTransformation;
+
+  /// \}
+
   /// \brief Destructor.
-  virtual ~CjrlJoint() {}
+  virtual ~CjrlJointTpl() {}
 
   /// \name Joint name
   /// \{
@@ -114,6 +148,14 @@ public:
   /// the first degree of freedom.
   virtual unsigned int rankInConfiguration() const = 0;
 
+  /// \brief Get the rank of this joint in the robot velocity vector.
+  ///
+  /// Differs from rankInConfiguration() when a joint before this one
+  /// has a number of configuration variables different from its
+  /// number of velocity degrees of freedom. The default
+  /// implementation returns rankInConfiguration().
+  virtual unsigned int rankInVelocity() const;
+
   /// \}
 
   /// \name Joint kinematics
@@ -135,6 +177,22 @@ public:
   /// \f${\bf q}\f$ of the robot.
   virtual const matrix4d &currentTransformation() const = 0;
 
+  /// \brief Get the initial position of the joint as a rotation and a
+  /// translation.
+  ///
+  /// Same transformation as initialPosition(). The default
+  /// implementation converts initialPosition().
+  virtual CjrlRigidTransformation initialPlacement() const;
+
+  /// \brief Get the current transformation of the joint as a rotation
+  /// and a translation.
+  ///
+  /// Same transformation as currentTransformation(). Composing
+  /// placements avoids the computations on the constant last row of
+  /// homogeneous matrices. The default implementation converts
+  /// currentTransformation().
+  virtual CjrlRigidTransformation currentPlacement() const;
+
   /// \brief Get the velocity \f$({\bf v}, {\bf \omega})\f$ of the joint.
   ///
   /// The velocity is determined by the configuration of the robot and
@@ -143,18 +201,84 @@ public:
   /// \return the linear velocity \f${\bf v}\f$ of the origin of the
   /// joint frame and the angular velocity \f${\bf \omega}\f$ of the
   /// joint frame.
-  virtual CjrlRigidVelocity jointVelocity() const =0;
+  ///
+  /// \note This method returns a copy of currentVelocity(), which
+  /// should be preferred in computation loops.
+  virtual CjrlRigidVelocity jointVelocity() const;
+
+  /// \brief Get the velocity of the joint by reference.
+  ///
+  /// Same value as jointVelocity(), stored by the joint when the
+  /// robot computes its forward kinematics. The reference stays valid
+  /// as long as the joint exists; its value changes at the next
+  /// forward kinematics computation.
+  virtual const CjrlRigidVelocity& currentVelocity() const = 0;
 
   /// \brief Get the acceleration of the joint.
   ///
   /// The acceleration is determined by the configuration of the robot
   /// and its first and second time derivative: \f$({\bf q},{\bf
   /// \dot{q}}, {\bf \ddot{q}})\f$.
-  virtual CjrlRigidAcceleration jointAcceleration() const=0;
+  ///
+  /// \note This method returns a copy of currentAcceleration(), which
+  /// should be preferred in computation loops.
+  virtual CjrlRigidAcceleration jointAcceleration() const;
+
+  /// \brief Get the acceleration of the joint by reference.
+  ///
+  /// Same value as jointAcceleration(), stored by the joint when the
+  /// robot computes its forward kinematics. The reference stays valid
+  /// as long as the joint exists; its value changes at the next
+  /// forward kinematics computation.
+  virtual const CjrlRigidAcceleration& currentAcceleration() const = 0;
 
   /// \brief Get the number of degrees of freedom of the joint.
+  ///
+  /// This is the number of variables of the joint in the
+  /// configuration vector.
   virtual unsigned int numberDof() const=0;
 
+  /// \brief Get the number of velocity degrees of freedom of the joint.
+  ///
+  /// This is the number of variables of the joint in the velocity and
+  /// acceleration vectors, for instance 6 for a quaternion freeflyer
+  /// joint for which numberDof() is 7. The default implementation
+  /// returns numberDof().
+  virtual unsigned int numberVelocityDof() const;
+
+  /// \brief Integrate a velocity over a time step.
+  ///
+  /// \param inConfig configuration of the robot.
+  /// \param inVelocity velocity of the robot.
+  /// \param inTimeStep duration of the integration.
+  /// \retval outConfig configuration reached from inConfig at constant
+  /// velocity. Only the variables of this joint, starting at
+  /// rankInConfiguration(), are written.
+  ///
+  /// The variables of the joint are read at rankInConfiguration() in
+  /// the configuration vectors and at rankInVelocity() in the velocity
+  /// vector. For a quaternion freeflyer joint, the result stays on
+  /// the unit sphere.
+  ///
+  /// \return false if not implemented.
+  virtual bool integrate(const vectorN& inConfig,
+			 const vectorN& inVelocity,
+			 Scalar inTimeStep,
+			 vectorN& outConfig) const;
+
+  /// \brief Compute the velocity leading from a configuration to another.
+  ///
+  /// \param inConfig0 start configuration of the robot.
+  /// \param inConfig1 end configuration of the robot.
+  /// \retval outVelocity velocity that, integrated over a unit time
+  /// step from inConfig0, leads to inConfig1. Only the variables of
+  /// this joint, starting at rankInVelocity(), are written.
+  ///
+  /// \return false if not implemented.
+  virtual bool difference(const vectorN& inConfig0,
+			  const vectorN& inConfig1,
+			  vectorN& outVelocity) const;
+
   /// \}
 
   /// \name Bounds of the degrees of freedom
@@ -163,81 +287,170 @@ public:
   /// \brief Get the lower bound of a given degree of freedom of the
   /// joint.
   ///
-  /// \param inDofRank Id of the dof in the joint
-  virtual double lowerBound(unsigned int inDofRank) const = 0;
+  /// \param inDofRank rank of the configuration variable in the joint,
+  /// from 0 to numberDof()-1.
+  virtual Scalar lowerBound(unsigned int inDofRank) const = 0;
 
   /// \brief Get the upper bound of a given degree of freedom of the joint.
   ///
-  /// \param inDofRank Id of the dof in the joint
-  virtual double upperBound(unsigned int inDofRank) const = 0;
+  /// \param inDofRank rank of the configuration variable in the joint,
+  /// from 0 to numberDof()-1.
+  virtual Scalar upperBound(unsigned int inDofRank) const = 0;
 
   /// \brief Set the lower bound of a given degree of freedom of the joint.
   ///
-  /// \param inDofRank Id of the dof in the joint
+  /// \param inDofRank rank of the configuration variable in the joint,
+  /// from 0 to numberDof()-1.
   /// \param inLowerBound lower bound
-  virtual void lowerBound(unsigned int inDofRank, double inLowerBound) = 0;
+  virtual void lowerBound(unsigned int inDofRank, Scalar inLowerBound) = 0;
 
   /// \brief Set the upper bound of a given degree of freedom of the joint.
   ///
-  /// \param inDofRank Id of the dof in the joint
+  /// \param inDofRank rank of the configuration variable in the joint,
+  /// from 0 to numberDof()-1.
   /// \param inUpperBound Upper bound.
-  virtual void upperBound(unsigned int inDofRank, double inUpperBound) = 0;
+  virtual void upperBound(unsigned int inDofRank, Scalar inUpperBound) = 0;
 
   /// \brief Get the lower velocity bound of a given degree of freedom
   /// of the joint.
   ///
-  /// \param inDofRank Id of the dof in the joint
-  virtual double lowerVelocityBound(unsigned int inDofRank) const = 0;
+  /// \param inDofRank rank of the velocity degree of freedom in the
+  /// joint, from 0 to numberVelocityDof()-1.
+  virtual Scalar lowerVelocityBound(unsigned int inDofRank) const = 0;
 
   /// \brief Get the upper veocity bound of a given degree of freedom
   /// of the joint.
   ///
-  /// \param inDofRank Id of the dof in the joint
-  virtual double upperVelocityBound(unsigned int inDofRank) const = 0;
+  /// \param inDofRank rank of the velocity degree of freedom in the
+  /// joint, from 0 to numberVelocityDof()-1.
+  virtual Scalar upperVelocityBound(unsigned int inDofRank) const = 0;
 
   /// \brief Set the lower velocity bound of a given degree of freedom
   /// of the joint.
   ///
-  /// \param inDofRank Id of the dof in the joint
+  /// \param inDofRank rank of the velocity degree of freedom in the
+  /// joint, from 0 to numberVelocityDof()-1.
   /// \param inLowerBound lower bound
   virtual void lowerVelocityBound(unsigned int inDofRank,
-				  double inLowerBound) = 0;
+				  Scalar inLowerBound) = 0;
 
   /// \brief Set the upper velocity bound of a given degree of freedom
   /// of the joint.
   ///
-  /// \param inDofRank Id of the dof in the joint
+  /// \param inDofRank rank of the velocity degree of freedom in the
+  /// joint, from 0 to numberVelocityDof()-1.
   /// \param inUpperBound Upper bound.
   virtual void upperVelocityBound(unsigned int inDofRank,
-				  double inUpperBound) = 0;
+				  Scalar inUpperBound) = 0;
 
   /// \brief Get the lower torque bound of a given degree of freedom
   /// of the joint.
   ///
-  /// \param inDofRank Id of the dof in the joint
-  virtual double lowerTorqueBound(unsigned int inDofRank) const = 0;
+  /// \param inDofRank rank of the velocity degree of freedom in the
+  /// joint, from 0 to numberVelocityDof()-1.
+  virtual Scalar lowerTorqueBound(unsigned int inDofRank) const = 0;
 
   /// \brief Get the upper veocity bound of a given degree of freedom
   /// of the joint.
   ///
-  /// \param inDofRank Id of the dof in the joint
-  virtual double upperTorqueBound(unsigned int inDofRank) const = 0;
+  /// \param inDofRank rank of the velocity degree of freedom in the
+  /// joint, from 0 to numberVelocityDof()-1.
+  virtual Scalar upperTorqueBound(unsigned int inDofRank) const = 0;
 
   /// \brief Set the lower torque bound of a given degree of freedom
   /// of the joint.
   ///
-  /// \param inDofRank Id of the dof in the joint
+  /// \param inDofRank rank of the velocity degree of freedom in the
+  /// joint, from 0 to numberVelocityDof()-1.
   /// \param inLowerBound lower bound
   virtual void lowerTorqueBound(unsigned int inDofRank,
-				double inLowerBound) = 0;
+				Scalar inLowerBound) = 0;
 
   /// \brief Set the upper torque bound of a given degree of freedom
   /// of the joint.
   ///
-  /// \param inDofRank Id of the dof in the joint
+  /// \param inDofRank rank of the velocity degree of freedom in the
+  /// joint, from 0 to numberVelocityDof()-1.
   /// \param inUpperBound Upper bound.
   virtual void upperTorqueBound(unsigned int inDofRank,
-				double inUpperBound) = 0;
+				Scalar inUpperBound) = 0;
+
+  /// \}
+
+  /// \name Actuator model of the degrees of freedom
+  ///
+  /// These parameters are taken into account by the dynamic
+  /// computations of the robot: the rotor inertia is added to the
+  /// diagonal of CjrlDynamicRobot::inertiaMatrix and both rotor
+  /// inertia and friction contribute to
+  /// CjrlDynamicRobot::currentJointTorques. These parameters are
+  /// given per velocity degree of freedom. For velocity degree of
+  /// freedom \f$i\f$, the contribution to the joint torque is
+  /// \f[
+  /// I_{a,i} \ddot{q}_i + f_{v,i} \dot{q}_i + f_{c,i}\,
+  /// \mathrm{sign}(\dot{q}_i)
+  /// \f]
+  /// where \f$I_{a,i}\f$ is the rotor inertia, \f$f_{v,i}\f$ the
+  /// viscous friction and \f$f_{c,i}\f$ the Coulomb friction
+  /// coefficient. All parameters are 0 by default.
+  /// \{
+
+  /// \brief Get the rotor inertia (armature) of a given degree of
+  /// freedom of the joint.
+  ///
+  /// The rotor inertia is the inertia of the actuator rotor reflected
+  /// through the transmission.
+  ///
+  /// \param inDofRank rank of the velocity degree of freedom in the
+  /// joint, from 0 to numberVelocityDof()-1.
+  virtual Scalar rotorInertia(unsigned int inDofRank) const;
+
+  /// \brief Set the rotor inertia (armature) of a given degree of
+  /// freedom of the joint.
+  ///
+  /// \param inDofRank rank of the velocity degree of freedom in the
+  /// joint, from 0 to numberVelocityDof()-1.
+  /// \param inRotorInertia Rotor inertia reflected through the
+  /// transmission.
+  ///
+  /// \return false if the implementation does not model rotor inertia.
+  virtual bool rotorInertia(unsigned int inDofRank, Scalar inRotorInertia);
+
+  /// \brief Get the viscous friction coefficient of a given degree of
+  /// freedom of the joint.
+  ///
+  /// \param inDofRank rank of the velocity degree of freedom in the
+  /// joint, from 0 to numberVelocityDof()-1.
+  virtual Scalar viscousFriction(unsigned int inDofRank) const;
+
+  /// \brief Set the viscous friction coefficient of a given degree of
+  /// freedom of the joint.
+  ///
+  /// \param inDofRank rank of the velocity degree of freedom in the
+  /// joint, from 0 to numberVelocityDof()-1.
+  /// \param inViscousFriction Viscous friction coefficient.
+  ///
+  /// \return false if the implementation does not model friction.
+  virtual bool viscousFriction(unsigned int inDofRank,
+			       Scalar inViscousFriction);
+
+  /// \brief Get the Coulomb friction coefficient of a given degree of
+  /// freedom of the joint.
+  ///
+  /// \param inDofRank rank of the velocity degree of freedom in the
+  /// joint, from 0 to numberVelocityDof()-1.
+  virtual Scalar coulombFriction(unsigned int inDofRank) const;
+
+  /// \brief Set the Coulomb friction coefficient of a given degree of
+  /// freedom of the joint.
+  ///
+  /// \param inDofRank rank of the velocity degree of freedom in the
+  /// joint, from 0 to numberVelocityDof()-1.
+  /// \param inCoulombFriction Coulomb friction coefficient.
+  ///
+  /// \return false if the implementation does not model friction.
+  virtual bool coulombFriction(unsigned int inDofRank,
+			       Scalar inCoulombFriction);
 
   /// \}
 
@@ -254,29 +467,61 @@ public:
      The corresponding computation can be done by the robot for each
      of its joints or by the joint.
 
-     \return a matrix \f$J \in {\bf R}^{6\times n_{dof}}\f$ defined by
+     \return a matrix \f$J \in {\bf R}^{6\times n_v}\f$, where
+     \f$n_v\f$ is CjrlDynamicRobot::numberVelocityDof(), defined by
      \f[
      J = \left(\begin{array}{llll}
-     {\bf v_1} & {\bf v_2} & \cdots & {\bf v_{n_{dof}}} \\
-     {\bf \omega_1} & {\bf \omega_2} & \cdots & {\bf \omega_{n_{dof}}}
+     {\bf v_1} & {\bf v_2} & \cdots & {\bf v_{n_v}} \\
+     {\bf \omega_1} & {\bf \omega_2} & \cdots & {\bf \omega_{n_v}}
      \end{array}\right)
      \f]
 
      where \f${\bf v_i}\f$ and \f${\bf \omega_i}\f$ are respectively
-     the linear and angular velocities of the joint implied by the
-     variation of degree of freedom \f$q_i\f$. The velocity of the
+     the linear and angular velocities of the joint implied by a unit
+     velocity of the velocity degree of freedom of rank \f$i\f$ (see
+     CjrlJoint::rankInVelocity). The velocity of the
      joint returned by CjrlJoint::jointVelocity can thus be obtained
      through the following formula:
 
      \f[
      \left(\begin{array}{l} {\bf v} \\ {\bf \omega}\end{array}\right) = J {\bf \dot{q}}
      \f]
+
+     This method returns the jacobian computed by the last call to
+     computeJacobianJointWrtConfig() or updateJacobianJointWrtConfig().
+     Whether it corresponds to the current configuration can be checked
+     with jacobianJointWrtConfigVersion().
   */
   virtual const matrixNxP& jacobianJointWrtConfig() const = 0;
 
   /// \brief Compute the joint's jacobian wrt the robot configuration.
   virtual void computeJacobianJointWrtConfig() = 0;
 
+  /// \brief Get the joint's jacobian wrt the robot configuration,
+  /// computing it only if the configuration has changed.
+  ///
+  /// The jacobian is recomputed only if
+  /// jacobianJointWrtConfigVersion() differs from the current
+  /// configuration version of the robot (see
+  /// CjrlDynamicRobot::configurationVersion). Repeated calls for the
+  /// same configuration thus return the cached jacobian at no cost.
+  ///
+  /// Like the joint transformations it is computed from, the jacobian
+  /// corresponds to the configuration of the last call to
+  /// CjrlDynamicRobot::computeForwardKinematics(): after setting a new
+  /// configuration, forward kinematics must be computed before calling
+  /// this method.
+  ///
+  /// By default, the jacobian is always recomputed.
+  virtual const matrixNxP& updateJacobianJointWrtConfig();
+
+  /// \brief Get the configuration version for which the cached joint's
+  /// jacobian has been computed.
+  ///
+  /// \return 0 if the jacobian has never been computed or if the
+  /// implementation does not track configuration versions.
+  virtual unsigned long jacobianJointWrtConfigVersion() const;
+
   /// \brief Get the jacobian of the point specified in local frame by
   /// inPointJointFrame.
   ///
@@ -285,6 +530,23 @@ public:
   virtual void getJacobianPointWrtConfig(const vector3d& inPointJointFrame,
 					 matrixNxP& outjacobian) const = 0;
 
+  /// \brief Get the jacobian of the point specified in local frame by
+  /// inPointJointFrame into caller supplied memory.
+  ///
+  /// Element \f$(i,j)\f$ of the jacobian is written at address
+  /// outjacobian + (inRowOffset + i) * inRowStride + j * inColumnStride.
+  /// Memory is never resized nor allocated: the caller provides a
+  /// block large enough for 6 rows and
+  /// CjrlDynamicRobot::numberVelocityDof() columns.
+  ///
+  /// \return false if the implementation does not support strided
+  /// output.
+  virtual bool getJacobianPointWrtConfigStrided(const vector3d& inPointJointFrame,
+						Scalar* outjacobian,
+						unsigned int inRowStride,
+						unsigned int inColumnStride,
+						unsigned int inRowOffset = 0) const;
+
   /// \}
 
   /// \name Body linked to the joint
@@ -299,4 +561,135 @@ public:
   /// \}
 };
 
+// Separate instantiation is required to avoid warnings with g++ (see
+// dynamic-robot.hh).
+template <typename Scalar>
+inline typename CjrlJointTpl<Scalar>::CjrlRigidTransformation
+CjrlJointTpl<Scalar>::initialPlacement() const
+{
+  return CjrlRigidTransformation(initialPosition());
+}
+
+template <typename Scalar>
+inline typename CjrlJointTpl<Scalar>::CjrlRigidTransformation
+CjrlJointTpl<Scalar>::currentPlacement() const
+{
+  return CjrlRigidTransformation(currentTransformation());
+}
+
+template <typename Scalar>
+inline unsigned int
+CjrlJointTpl<Scalar>::rankInVelocity() const
+{
+  return rankInConfiguration();
+}
+
+template <typename Scalar>
+inline unsigned int
+CjrlJointTpl<Scalar>::numberVelocityDof() const
+{
+  return numberDof();
+}
+
+template <typename Scalar>
+inline bool
+CjrlJointTpl<Scalar>::integrate(const vectorN&,
+				const vectorN&,
+				Scalar,
+				vectorN&) const
+{
+  return false;
+}
+
+template <typename Scalar>
+inline bool
+CjrlJointTpl<Scalar>::difference(const vectorN&,
+				 const vectorN&,
+				 vectorN&) const
+{
+  return false;
+}
+
+template <typename Scalar>
+inline typename CjrlJointTpl<Scalar>::CjrlRigidVelocity
+CjrlJointTpl<Scalar>::jointVelocity() const
+{
+  return currentVelocity();
+}
+
+template <typename Scalar>
+inline typename CjrlJointTpl<Scalar>::CjrlRigidAcceleration
+CjrlJointTpl<Scalar>::jointAcceleration() const
+{
+  return currentAcceleration();
+}
+
+template <typename Scalar>
+inline const typename CjrlJointTpl<Scalar>::matrixNxP&
+CjrlJointTpl<Scalar>::updateJacobianJointWrtConfig()
+{
+  computeJacobianJointWrtConfig();
+  return jacobianJointWrtConfig();
+}
+
+template <typename Scalar>
+inline unsigned long
+CjrlJointTpl<Scalar>::jacobianJointWrtConfigVersion() const
+{
+  return 0;
+}
+
+template <typename Scalar>
+inline bool
+CjrlJointTpl<Scalar>::getJacobianPointWrtConfigStrided(const vector3d&,
+						       Scalar*,
+						       unsigned int,
+						       unsigned int,
+						       unsigned int) const
+{
+  return false;
+}
+
+template <typename Scalar>
+inline Scalar
+CjrlJointTpl<Scalar>::rotorInertia(unsigned int) const
+{
+  return Scalar (0.);
+}
+
+template <typename Scalar>
+inline bool
+CjrlJointTpl<Scalar>::rotorInertia(unsigned int, Scalar)
+{
+  return false;
+}
+
+template <typename Scalar>
+inline Scalar
+CjrlJointTpl<Scalar>::viscousFriction(unsigned int) const
+{
+  return Scalar (0.);
+}
+
+template <typename Scalar>
+inline bool
+CjrlJointTpl<Scalar>::viscousFriction(unsigned int, Scalar)
+{
+  return false;
+}
+
+template <typename Scalar>
+inline Scalar
+CjrlJointTpl<Scalar>::coulombFriction(unsigned int) const
+{
+  return Scalar (0.);
+}
+
+template <typename Scalar>
+inline bool
+CjrlJointTpl<Scalar>::coulombFriction(unsigned int, Scalar)
+{
+  return false;
+}
+
 #endif //! ABSTRACT_ROBOT_DYNAMICS_JOINT_HH
@@ -17,6 +17,10 @@
 #ifndef ABSTRACT_ROBOT_DYNAMICS_RIGID_ACCELERATION_HH
 # define ABSTRACT_ROBOT_DYNAMICS_RIGID_ACCELERATION_HH
 # include <abstract-robot-dynamics/fwd.hh>
+# include <abstract-robot-dynamics/scalar-traits.hh>
+# if __cplusplus >= 201103L
+#  include <type_traits>
+# endif //! __cplusplus >= 201103L
 
 /**
    \brief This class represents the acceleration of a rigid body.
@@ -26,17 +30,44 @@
    derivative of the linear velocity vector) and
    \li a rotation acceleration vector \f${\bf \dot{\omega}}\f$ (the
    time derivative of the rotation velocity vector).
+
+   CjrlRigidAcceleration is the instantiation for double.
 */
-class CjrlRigidAcceleration
+template <typename Scalar>
+class CjrlRigidAccelerationTpl
 {
 public:
+  typedef typename CjrlScalarTraits<Scalar>::vector3d vector3d;
+
+  /// \brief Constructor.
+  CjrlRigidAccelerationTpl()
+    : attLinearAcceleration (),
+      attRotationAcceleration ()
+  {}
+
   /// \brief Constructor.
-  CjrlRigidAcceleration(const vector3d& inLinearAcceleration,
-			const vector3d& inRotationAcceleration)
+  CjrlRigidAccelerationTpl(const vector3d& inLinearAcceleration,
+			   const vector3d& inRotationAcceleration)
     : attLinearAcceleration (inLinearAcceleration),
       attRotationAcceleration (inRotationAcceleration)
   {}
 
+# if __cplusplus >= 201103L
+  /// \name Copy and move
+  ///
+  /// Moving is noexcept whenever moving a vector3d is, so that
+  /// containers of accelerations relocate their elements by move
+  /// instead of copy.
+  /// \{
+  CjrlRigidAccelerationTpl(const CjrlRigidAccelerationTpl&) = default;
+  CjrlRigidAccelerationTpl(CjrlRigidAccelerationTpl&&)
+    noexcept(std::is_nothrow_move_constructible<vector3d>::value) = default;
+  CjrlRigidAccelerationTpl& operator=(const CjrlRigidAccelerationTpl&) = default;
+  CjrlRigidAccelerationTpl& operator=(CjrlRigidAccelerationTpl&&)
+    noexcept(std::is_nothrow_move_assignable<vector3d>::value) = default;
+  /// \}
+# endif //! __cplusplus >= 201103L
+
   /// \brief Get the linear acceleration vector.
   const vector3d& linearAcceleration() const
   {
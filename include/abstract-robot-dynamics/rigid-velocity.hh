@@ -17,28 +17,52 @@
 #ifndef ABSTRACT_ROBOT_DYNAMICS_RIGID_VELOCITY_HH
 # define ABSTRACT_ROBOT_DYNAMICS_RIGID_VELOCITY_HH
 # include <abstract-robot-dynamics/fwd.hh>
+# include <abstract-robot-dynamics/scalar-traits.hh>
+# if __cplusplus >= 201103L
+#  include <type_traits>
+# endif //! __cplusplus >= 201103L
 
 /// \brief This class represents the velocity of a rigid body.
 ///
 /// The velocity is represented by
 /// \li a linear velocity vector \f${\bf v}\f$ and
 /// \li a rotation velocity vector \f${\bf \omega}\f$.
-class CjrlRigidVelocity
+///
+/// CjrlRigidVelocity is the instantiation for double.
+template <typename Scalar>
+class CjrlRigidVelocityTpl
 {
 public:
+  typedef typename CjrlScalarTraits<Scalar>::vector3d vector3d;
+
   /// \brief Constructor.
-  CjrlRigidVelocity()
+  CjrlRigidVelocityTpl()
     : attLinearVelocity (),
       attRotationVelocity ()
   {}
 
   /// \brief Constructor.
-  CjrlRigidVelocity(const vector3d& inLinearVelocity,
-		    const vector3d& inRotationVelocity)
+  CjrlRigidVelocityTpl(const vector3d& inLinearVelocity,
+		       const vector3d& inRotationVelocity)
     : attLinearVelocity (inLinearVelocity),
       attRotationVelocity (inRotationVelocity)
   {}
 
+# if __cplusplus >= 201103L
+  /// \name Copy and move
+  ///
+  /// Moving is noexcept whenever moving a vector3d is, so that
+  /// containers of velocities relocate their elements by move
+  /// instead of copy.
+  /// \{
+  CjrlRigidVelocityTpl(const CjrlRigidVelocityTpl&) = default;
+  CjrlRigidVelocityTpl(CjrlRigidVelocityTpl&&)
+    noexcept(std::is_nothrow_move_constructible<vector3d>::value) = default;
+  CjrlRigidVelocityTpl& operator=(const CjrlRigidVelocityTpl&) = default;
+  CjrlRigidVelocityTpl& operator=(CjrlRigidVelocityTpl&&)
+    noexcept(std::is_nothrow_move_assignable<vector3d>::value) = default;
+  /// \}
+# endif //! __cplusplus >= 201103L
 
   /// \brief Get the linear velocity vector.
   const vector3d& linearVelocity() const
@@ -16,13 +16,34 @@
 
 #ifndef ABSTRACT_ROBOT_DYNAMICS_ROBOT_DYNAMICS_OBJECT_CONSTRUCTOR
 # define ABSTRACT_ROBOT_DYNAMICS_ROBOT_DYNAMICS_OBJECT_CONSTRUCTOR
+# include <cstddef>
+# include <string>
+
 # include <abstract-robot-dynamics/fwd.hh>
+# include <abstract-robot-dynamics/io.hh>
 # include <abstract-robot-dynamics/humanoid-dynamic-robot.hh>
+# include <abstract-robot-dynamics/batch-evaluator.hh>
+
+/**
+   \brief The creation of an object.
 
-/// \brief The creation of an object.
+   \par Memory management
+   A factory may allocate the objects it creates contiguously, in
+   construction order, from a memory arena, so that traversals of the
+   kinematic chain access memory sequentially. Such a factory reports
+   it through usesArena(). Its objects are then owned by the factory:
+   \li they must not be deleted individually, and are destroyed at
+   once by releaseAll() or by the destructor of the factory,
+   \li a robot built from them must not delete its joints, bodies,
+   hands or feet when it is destroyed,
+   \li releaseAll() may only be called, and the factory destroyed,
+   after every robot referencing these objects has been destroyed.
+*/
 class CjrlRobotDynamicsObjectFactory
 {
 public:
+  typedef CjrlScalarTraits<double>::matrix4d matrix4d;
+
   /// \brief Destructor.
   virtual ~CjrlRobotDynamicsObjectFactory() {}
 
@@ -48,6 +69,20 @@ public:
   virtual CjrlJoint*
   createJointFreeflyer(const matrix4d& inInitialPosition) = 0;
 
+  /// \brief Construct and return a pointer to a freeflyer joint
+  /// parameterized by a quaternion.
+  ///
+  /// \param inInitialPosition position of the local frame of the
+  /// joint when the robot is in initial configuration.
+  ///
+  /// The joint has 7 configuration variables
+  /// \f$(x, y, z, q_x, q_y, q_z, q_w)\f$ and 6 velocity degrees of
+  /// freedom (see CjrlJoint).
+  ///
+  /// \return 0 if not implemented.
+  virtual CjrlJoint*
+  createJointQuaternionFreeflyer(const matrix4d& inInitialPosition);
+
   /// \brief Construct and return a pointer to a rotation joint.
   ///
   /// \param inInitialPosition position of the local frame of the
@@ -73,6 +108,150 @@ public:
   ///
   /// \param inAnkle The joint the foot is attached to.
   virtual CjrlFoot* createFoot(CjrlJoint* inAnkle) = 0;
+
+  /// \brief Construct and return a pointer to a batch evaluator.
+  ///
+  /// \param inRobot initialized robot the evaluator computes the
+  /// kinematics and dynamics of. It must exist as long as the
+  /// evaluator.
+  /// \param inNumberThreads number of threads used by the evaluator, 0
+  /// to use as many threads as the hardware supports.
+  ///
+  /// \return 0 if not implemented.
+  virtual CjrlBatchEvaluator*
+  createBatchEvaluator(const CjrlDynamicRobot& inRobot,
+		       unsigned int inNumberThreads = 0);
+
+  /// \name Memory management
+  /// \{
+
+  /// \brief Whether the objects are allocated in an arena owned by
+  /// the factory.
+  virtual bool usesArena() const;
+
+  /// \brief Reserve memory in the arena.
+  ///
+  /// \param inSize number of bytes to reserve. Reserving the memory of
+  /// the whole robot before creating its objects keeps them in one
+  /// block.
+  ///
+  /// \return false if the factory does not use an arena.
+  virtual bool reserve(std::size_t inSize);
+
+  /// \brief Get the number of bytes allocated for the objects
+  /// created by the factory and not yet destroyed.
+  ///
+  /// \retval outSize number of bytes, written only if true is
+  /// returned. It may be 0, for instance for an empty arena.
+  ///
+  /// \return false if not implemented.
+  virtual bool memoryFootprint(std::size_t& outSize) const;
+
+  /// \brief Destroy all the objects created by the factory.
+  ///
+  /// The memory of the arena is released in one operation. No robot
+  /// referencing objects of the arena may exist any more.
+  ///
+  /// \return false if the factory does not use an arena.
+  virtual bool releaseAll();
+
+  /// \}
+
+  /// \name Binary model files
+  ///
+  /// See \ref abstractRobotDynamics_modelFormat "the description of the
+  /// format".
+  /// \{
+
+  /// \brief Save the model of a robot into a binary file.
+  ///
+  /// \param inRobot initialized robot. If it is a
+  /// CjrlHumanoidDynamicRobot, the joints, hands and feet specific to
+  /// humanoid robots are saved as well.
+  /// \param inFileName name of the file.
+  ///
+  /// \return false if not implemented or if the file cannot be written.
+  virtual bool saveModel(const CjrlDynamicRobot& inRobot,
+			 const std::string& inFileName);
+
+  /// \brief Construct a robot from a binary model file.
+  ///
+  /// \param inFileName name of the file.
+  ///
+  /// The file is mapped in memory and may be used in place by the
+  /// returned robot, that is initialized, until it is deleted.
+  ///
+  /// \return 0 if not implemented or if the file is not a valid model
+  /// file of a known version.
+  virtual CjrlDynamicRobot* loadDynamicRobot(const std::string& inFileName);
+
+  /// \brief Construct a humanoid robot from a binary model file.
+  ///
+  /// Same as loadDynamicRobot(), for files saved from a humanoid robot.
+  ///
+  /// \return 0 if not implemented, if the file is not a valid model
+  /// file of a known version, or if it does not describe a humanoid
+  /// robot.
+  virtual CjrlHumanoidDynamicRobot*
+  loadHumanoidDynamicRobot(const std::string& inFileName);
+
+  /// \}
 };
 
+inline CjrlJoint*
+CjrlRobotDynamicsObjectFactory::createJointQuaternionFreeflyer(const matrix4d&)
+{
+  return 0;
+}
+
+inline CjrlBatchEvaluator*
+CjrlRobotDynamicsObjectFactory::createBatchEvaluator(const CjrlDynamicRobot&,
+						     unsigned int)
+{
+  return 0;
+}
+
+inline bool
+CjrlRobotDynamicsObjectFactory::usesArena() const
+{
+  return false;
+}
+
+inline bool
+CjrlRobotDynamicsObjectFactory::reserve(std::size_t)
+{
+  return false;
+}
+
+inline bool
+CjrlRobotDynamicsObjectFactory::memoryFootprint(std::size_t&) const
+{
+  return false;
+}
+
+inline bool
+CjrlRobotDynamicsObjectFactory::releaseAll()
+{
+  return false;
+}
+
+inline bool
+CjrlRobotDynamicsObjectFactory::saveModel(const CjrlDynamicRobot&,
+					  const std::string&)
+{
+  return false;
+}
+
+inline CjrlDynamicRobot*
+CjrlRobotDynamicsObjectFactory::loadDynamicRobot(const std::string&)
+{
+  return 0;
+}
+
+inline CjrlHumanoidDynamicRobot*
+CjrlRobotDynamicsObjectFactory::loadHumanoidDynamicRobot(const std::string&)
+{
+  return 0;
+}
+
 #endif //! ABSTRACT_ROBOT_DYNAMICS_ROBOT_DYNAMICS_OBJECT_CONSTRUCTOR
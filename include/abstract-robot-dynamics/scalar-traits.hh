@@ -0,0 +1,91 @@
+// Copyright 2026, CNRS/AIST
+//
+// This file is part of abstract-robot-dynamics.
+// abstract-robot-dynamics is free software: you can redistribute it
+// and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version
+// 3 of the License, or (at your option) any later version.
+//
+// abstract-robot-dynamics is distributed in the hope that it will be
+// useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+// of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Lesser Public License for more details.  You should have
+// received a copy of the GNU Lesser General Public License along with
+// abstract-robot-dynamics.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef ABSTRACT_ROBOT_DYNAMICS_SCALAR_TRAITS_HH
+# define ABSTRACT_ROBOT_DYNAMICS_SCALAR_TRAITS_HH
+
+/**
+   \brief Mathematical types used by the interface for a given scalar
+   type.
+
+   The class templates of the interface (CjrlJointTpl, CjrlBodyTpl,
+   CjrlDynamicRobotTpl, CjrlRigidVelocityTpl and
+   CjrlRigidAccelerationTpl) are parameterized by a scalar type. They
+   get their vector and matrix types from this class:
+
+   \li <b>vector3d</b> to represent a 3D point or vector,
+   \li <b>matrix3d</b> to represent a 3 by 3 matrix,
+   \li <b>matrix4d</b> to represent an homogeneous matrix,
+   \li <b>vectorN</b> to represent vectors of any size,
+   \li <b>matrixNxP</b> to represent matrices of any size.
+
+   By default, only the specialization for double is defined: it uses
+   the types provided by jrl-mal. An implementation supporting another
+   scalar type, for instance float or an automatic differentiation
+   type, provides the corresponding specialization:
+   \code
+   template <>
+   struct CjrlScalarTraits<float>
+   {
+     typedef Vector3f vector3d;
+     typedef Matrix3f matrix3d;
+     typedef Matrix4f matrix4d;
+     typedef VectorXf vectorN;
+     typedef MatrixXf matrixNxP;
+   };
+   \endcode
+
+   When the package is configured with option USE_EIGEN, macro
+   ABSTRACT_ROBOT_DYNAMICS_USE_EIGEN is defined and Eigen types are
+   used instead, for any scalar type. Fixed-size types are then
+   allocated on the stack and their operations are unrolled at compile
+   time.
+
+   \note Implementation classes storing a matrix4d by value must then
+   use EIGEN_MAKE_ALIGNED_OPERATOR_NEW.
+*/
+# ifdef ABSTRACT_ROBOT_DYNAMICS_USE_EIGEN
+#  include <Eigen/Core>
+
+template <typename Scalar>
+struct CjrlScalarTraits
+{
+  typedef Eigen::Matrix<Scalar, 3, 1> vector3d;
+  typedef Eigen::Matrix<Scalar, 3, 3> matrix3d;
+  typedef Eigen::Matrix<Scalar, 4, 4> matrix4d;
+  typedef Eigen::Matrix<Scalar, Eigen::Dynamic, 1> vectorN;
+  typedef Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> matrixNxP;
+};
+
+# else //! ABSTRACT_ROBOT_DYNAMICS_USE_EIGEN
+
+template <typename Scalar>
+struct CjrlScalarTraits;
+
+/// \brief Mathematical types provided by jrl-mal for double.
+template <>
+struct CjrlScalarTraits<double>
+{
+  typedef ::vector3d vector3d;
+  typedef ::matrix3d matrix3d;
+  typedef ::matrix4d matrix4d;
+  typedef ::vectorN vectorN;
+  typedef ::matrixNxP matrixNxP;
+};
+
+# endif //! ABSTRACT_ROBOT_DYNAMICS_USE_EIGEN
+
+#endif //! ABSTRACT_ROBOT_DYNAMICS_SCALAR_TRAITS_HH
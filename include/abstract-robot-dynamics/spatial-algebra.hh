@@ -0,0 +1,636 @@
+// Copyright 2026, CNRS/AIST
+//
+// This file is part of abstract-robot-dynamics.
+// abstract-robot-dynamics is free software: you can redistribute it
+// and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version
+// 3 of the License, or (at your option) any later version.
+//
+// abstract-robot-dynamics is distributed in the hope that it will be
+// useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+// of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Lesser Public License for more details.  You should have
+// received a copy of the GNU Lesser General Public License along with
+// abstract-robot-dynamics.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef ABSTRACT_ROBOT_DYNAMICS_SPATIAL_ALGEBRA_HH
+# define ABSTRACT_ROBOT_DYNAMICS_SPATIAL_ALGEBRA_HH
+# include <abstract-robot-dynamics/fwd.hh>
+# include <abstract-robot-dynamics/scalar-traits.hh>
+# include <abstract-robot-dynamics/body.hh>
+# include <abstract-robot-dynamics/rigid-acceleration.hh>
+# include <abstract-robot-dynamics/rigid-velocity.hh>
+
+/**
+   \brief Elementary operations on 3D vectors and matrices.
+
+   The operations only rely on element access, so that they are
+   available for any type provided by CjrlScalarTraits. They are fully
+   unrolled and never allocate memory.
+*/
+template <typename Scalar>
+struct CjrlSpatialAlgebraToolsTpl
+{
+  typedef typename CjrlScalarTraits<Scalar>::vector3d vector3d;
+  typedef typename CjrlScalarTraits<Scalar>::matrix3d matrix3d;
+
+  /// \brief Get the cross product \f${\bf a} \times {\bf b}\f$.
+  static vector3d cross(const vector3d& a, const vector3d& b)
+  {
+    return vector3d(a(1) * b(2) - a(2) * b(1),
+		    a(2) * b(0) - a(0) * b(2),
+		    a(0) * b(1) - a(1) * b(0));
+  }
+
+  /// \brief Get the dot product \f${\bf a}^T {\bf b}\f$.
+  static Scalar dot(const vector3d& a, const vector3d& b)
+  {
+    return a(0) * b(0) + a(1) * b(1) + a(2) * b(2);
+  }
+
+  /// \brief Get the product \f$M {\bf v}\f$.
+  static vector3d multiply(const matrix3d& M, const vector3d& v)
+  {
+    return vector3d(M(0,0) * v(0) + M(0,1) * v(1) + M(0,2) * v(2),
+		    M(1,0) * v(0) + M(1,1) * v(1) + M(1,2) * v(2),
+		    M(2,0) * v(0) + M(2,1) * v(1) + M(2,2) * v(2));
+  }
+
+  /// \brief Get the product \f$M^T {\bf v}\f$.
+  static vector3d transposeMultiply(const matrix3d& M, const vector3d& v)
+  {
+    return vector3d(M(0,0) * v(0) + M(1,0) * v(1) + M(2,0) * v(2),
+		    M(0,1) * v(0) + M(1,1) * v(1) + M(2,1) * v(2),
+		    M(0,2) * v(0) + M(1,2) * v(1) + M(2,2) * v(2));
+  }
+
+  /// \brief Get the product \f$A B\f$.
+  static matrix3d multiply(const matrix3d& A, const matrix3d& B)
+  {
+    matrix3d result;
+    for (unsigned int i = 0; i < 3; ++i)
+      for (unsigned int j = 0; j < 3; ++j)
+	result(i,j) = A(i,0) * B(0,j) + A(i,1) * B(1,j) + A(i,2) * B(2,j);
+    return result;
+  }
+
+  /// \brief Get the transpose \f$M^T\f$.
+  static matrix3d transpose(const matrix3d& M)
+  {
+    matrix3d result;
+    for (unsigned int i = 0; i < 3; ++i)
+      for (unsigned int j = 0; j < 3; ++j)
+	result(i,j) = M(j,i);
+    return result;
+  }
+
+  /// \brief Get the 3 by 3 zero matrix.
+  static matrix3d zero()
+  {
+    matrix3d result;
+    for (unsigned int i = 0; i < 3; ++i)
+      for (unsigned int j = 0; j < 3; ++j)
+	result(i,j) = Scalar (0);
+    return result;
+  }
+
+  /// \brief Get the 3 by 3 identity matrix.
+  static matrix3d identity()
+  {
+    matrix3d result;
+    for (unsigned int i = 0; i < 3; ++i)
+      for (unsigned int j = 0; j < 3; ++j)
+	result(i,j) = (i == j) ? Scalar (1) : Scalar (0);
+    return result;
+  }
+};
+
+/**
+   \brief This class represents a spatial force (wrench).
+
+   The force is represented by
+   \li a linear force vector \f${\bf f}\f$ and
+   \li a torque vector \f${\bf \tau}\f$ at the origin of the frame
+   it is expressed in.
+
+   CjrlSpatialForce is the instantiation for double.
+*/
+template <typename Scalar>
+class CjrlSpatialForceTpl
+{
+public:
+  typedef typename CjrlScalarTraits<Scalar>::vector3d vector3d;
+
+  /// \brief Constructor of a zero force.
+  CjrlSpatialForceTpl()
+    : attLinear (Scalar (0), Scalar (0), Scalar (0)),
+      attAngular (Scalar (0), Scalar (0), Scalar (0))
+  {}
+
+  /// \brief Constructor.
+  CjrlSpatialForceTpl(const vector3d& inLinear,
+		      const vector3d& inAngular)
+    : attLinear (inLinear),
+      attAngular (inAngular)
+  {}
+
+  /// \brief Get the linear force vector.
+  const vector3d& linear() const
+  {
+    return attLinear;
+  }
+
+  /// \brief Set the linear force vector.
+  void linear(const vector3d& inLinear)
+  {
+    attLinear = inLinear;
+  }
+
+  /// \brief Get the torque vector.
+  const vector3d& angular() const
+  {
+    return attAngular;
+  }
+
+  /// \brief Set the torque vector.
+  void angular(const vector3d& inAngular)
+  {
+    attAngular = inAngular;
+  }
+
+  CjrlSpatialForceTpl operator+(const CjrlSpatialForceTpl& inForce) const
+  {
+    return CjrlSpatialForceTpl(attLinear + inForce.attLinear,
+			       attAngular + inForce.attAngular);
+  }
+
+  CjrlSpatialForceTpl operator-(const CjrlSpatialForceTpl& inForce) const
+  {
+    return CjrlSpatialForceTpl(attLinear - inForce.attLinear,
+			       attAngular - inForce.attAngular);
+  }
+
+  CjrlSpatialForceTpl operator*(const Scalar& inScalar) const
+  {
+    return CjrlSpatialForceTpl(attLinear * inScalar, attAngular * inScalar);
+  }
+
+  CjrlSpatialForceTpl& operator+=(const CjrlSpatialForceTpl& inForce)
+  {
+    attLinear += inForce.attLinear;
+    attAngular += inForce.attAngular;
+    return *this;
+  }
+
+  CjrlSpatialForceTpl& operator-=(const CjrlSpatialForceTpl& inForce)
+  {
+    attLinear -= inForce.attLinear;
+    attAngular -= inForce.attAngular;
+    return *this;
+  }
+
+private:
+  /// \brief Linear force vector.
+  vector3d attLinear;
+  /// \brief Torque vector.
+  vector3d attAngular;
+};
+
+/**
+   \brief This class represents a spatial motion vector.
+
+   A spatial motion vector is a velocity or an acceleration of a rigid
+   body, represented by
+   \li a linear vector \f${\bf v}\f$ of the point of the body
+   coinciding with the origin of the frame it is expressed in and
+   \li a rotation vector \f${\bf \omega}\f$.
+
+   It replaces the pair CjrlRigidVelocity and CjrlRigidAcceleration
+   in computations, and can be converted from and to them.
+
+   CjrlSpatialMotion is the instantiation for double.
+*/
+template <typename Scalar>
+class CjrlSpatialMotionTpl
+{
+public:
+  typedef typename CjrlScalarTraits<Scalar>::vector3d vector3d;
+  typedef CjrlSpatialAlgebraToolsTpl<Scalar> tools;
+
+  /// \brief Constructor of a zero motion.
+  CjrlSpatialMotionTpl()
+    : attLinear (Scalar (0), Scalar (0), Scalar (0)),
+      attAngular (Scalar (0), Scalar (0), Scalar (0))
+  {}
+
+  /// \brief Constructor.
+  CjrlSpatialMotionTpl(const vector3d& inLinear,
+		       const vector3d& inAngular)
+    : attLinear (inLinear),
+      attAngular (inAngular)
+  {}
+
+  /// \brief Constructor from a rigid body velocity.
+  explicit
+  CjrlSpatialMotionTpl(const CjrlRigidVelocityTpl<Scalar>& inVelocity)
+    : attLinear (inVelocity.linearVelocity()),
+      attAngular (inVelocity.rotationVelocity())
+  {}
+
+  /// \brief Constructor from a rigid body acceleration.
+  explicit
+  CjrlSpatialMotionTpl(const CjrlRigidAccelerationTpl<Scalar>& inAcceleration)
+    : attLinear (inAcceleration.linearAcceleration()),
+      attAngular (inAcceleration.rotationAcceleration())
+  {}
+
+  /// \brief Get the linear vector.
+  const vector3d& linear() const
+  {
+    return attLinear;
+  }
+
+  /// \brief Set the linear vector.
+  void linear(const vector3d& inLinear)
+  {
+    attLinear = inLinear;
+  }
+
+  /// \brief Get the rotation vector.
+  const vector3d& angular() const
+  {
+    return attAngular;
+  }
+
+  /// \brief Set the rotation vector.
+  void angular(const vector3d& inAngular)
+  {
+    attAngular = inAngular;
+  }
+
+  /// \brief Convert into a rigid body velocity.
+  CjrlRigidVelocityTpl<Scalar> rigidVelocity() const
+  {
+    return CjrlRigidVelocityTpl<Scalar>(attLinear, attAngular);
+  }
+
+  /// \brief Convert into a rigid body acceleration.
+  CjrlRigidAccelerationTpl<Scalar> rigidAcceleration() const
+  {
+    return CjrlRigidAccelerationTpl<Scalar>(attLinear, attAngular);
+  }
+
+  CjrlSpatialMotionTpl operator+(const CjrlSpatialMotionTpl& inMotion) const
+  {
+    return CjrlSpatialMotionTpl(attLinear + inMotion.attLinear,
+				attAngular + inMotion.attAngular);
+  }
+
+  CjrlSpatialMotionTpl operator-(const CjrlSpatialMotionTpl& inMotion) const
+  {
+    return CjrlSpatialMotionTpl(attLinear - inMotion.attLinear,
+				attAngular - inMotion.attAngular);
+  }
+
+  CjrlSpatialMotionTpl operator*(const Scalar& inScalar) const
+  {
+    return CjrlSpatialMotionTpl(attLinear * inScalar, attAngular * inScalar);
+  }
+
+  CjrlSpatialMotionTpl& operator+=(const CjrlSpatialMotionTpl& inMotion)
+  {
+    attLinear += inMotion.attLinear;
+    attAngular += inMotion.attAngular;
+    return *this;
+  }
+
+  CjrlSpatialMotionTpl& operator-=(const CjrlSpatialMotionTpl& inMotion)
+  {
+    attLinear -= inMotion.attLinear;
+    attAngular -= inMotion.attAngular;
+    return *this;
+  }
+
+  /// \brief Get the cross product of this motion by another motion.
+  ///
+  /// This is the derivative of inMotion when moving with this motion.
+  CjrlSpatialMotionTpl cross(const CjrlSpatialMotionTpl& inMotion) const
+  {
+    return CjrlSpatialMotionTpl
+      (tools::cross(attAngular, inMotion.attLinear)
+       + tools::cross(attLinear, inMotion.attAngular),
+       tools::cross(attAngular, inMotion.attAngular));
+  }
+
+  /// \brief Get the cross product of this motion by a force.
+  ///
+  /// This is the derivative of inForce when moving with this motion.
+  CjrlSpatialForceTpl<Scalar>
+  cross(const CjrlSpatialForceTpl<Scalar>& inForce) const
+  {
+    return CjrlSpatialForceTpl<Scalar>
+      (tools::cross(attAngular, inForce.linear()),
+       tools::cross(attAngular, inForce.angular())
+       + tools::cross(attLinear, inForce.linear()));
+  }
+
+  /// \brief Get the power of a force along this motion.
+  Scalar dot(const CjrlSpatialForceTpl<Scalar>& inForce) const
+  {
+    return tools::dot(attLinear, inForce.linear())
+      + tools::dot(attAngular, inForce.angular());
+  }
+
+private:
+  /// \brief Linear vector.
+  vector3d attLinear;
+  /// \brief Rotation vector.
+  vector3d attAngular;
+};
+
+/**
+   \brief This class represents the spatial inertia of a rigid body.
+
+   The inertia is represented by
+   \li the mass \f$m\f$ of the body,
+   \li the position \f${\bf c}\f$ of its center of mass and
+   \li its inertia matrix \f$I_c\f$ at the center of mass,
+   expressed in the frame the spatial inertia is expressed in, as
+   CjrlBody::inertiaMatrix.
+
+   CjrlSpatialInertia is the instantiation for double.
+*/
+template <typename Scalar>
+class CjrlSpatialInertiaTpl
+{
+public:
+  typedef typename CjrlScalarTraits<Scalar>::vector3d vector3d;
+  typedef typename CjrlScalarTraits<Scalar>::matrix3d matrix3d;
+  typedef CjrlSpatialAlgebraToolsTpl<Scalar> tools;
+
+  /// \brief Constructor of a zero inertia.
+  CjrlSpatialInertiaTpl()
+    : attMass (Scalar (0)),
+      attCenterOfMass (Scalar (0), Scalar (0), Scalar (0)),
+      attInertiaMatrix (tools::zero())
+  {}
+
+  /// \brief Constructor.
+  CjrlSpatialInertiaTpl(const Scalar& inMass,
+			const vector3d& inCenterOfMass,
+			const matrix3d& inInertiaMatrix)
+    : attMass (inMass),
+      attCenterOfMass (inCenterOfMass),
+      attInertiaMatrix (inInertiaMatrix)
+  {}
+
+  /// \brief Constructor from a body, in the local frame of its joint.
+  explicit CjrlSpatialInertiaTpl(const CjrlBodyTpl<Scalar>& inBody)
+    : attMass (inBody.mass()),
+      attCenterOfMass (inBody.localCenterOfMass()),
+      attInertiaMatrix (inBody.inertiaMatrix())
+  {}
+
+  /// \brief Get mass.
+  const Scalar& mass() const
+  {
+    return attMass;
+  }
+
+  /// \brief Get position of the center of mass.
+  const vector3d& centerOfMass() const
+  {
+    return attCenterOfMass;
+  }
+
+  /// \brief Get inertia matrix at the center of mass.
+  const matrix3d& inertiaMatrix() const
+  {
+    return attInertiaMatrix;
+  }
+
+  /// \brief Get the momentum of the body moving with a given motion.
+  CjrlSpatialForceTpl<Scalar>
+  operator*(const CjrlSpatialMotionTpl<Scalar>& inMotion) const
+  {
+    const vector3d linear =
+      (inMotion.linear()
+       - tools::cross(attCenterOfMass, inMotion.angular())) * attMass;
+    return CjrlSpatialForceTpl<Scalar>
+      (linear,
+       tools::multiply(attInertiaMatrix, inMotion.angular())
+       + tools::cross(attCenterOfMass, linear));
+  }
+
+  /// \brief Get the inertia of the union of two bodies.
+  ///
+  /// Both inertias must be expressed in the same frame.
+  CjrlSpatialInertiaTpl
+  operator+(const CjrlSpatialInertiaTpl& inInertia) const
+  {
+    const Scalar mass = attMass + inInertia.attMass;
+    if (mass == Scalar (0))
+      return CjrlSpatialInertiaTpl();
+    const vector3d centerOfMass =
+      (attCenterOfMass * attMass
+       + inInertia.attCenterOfMass * inInertia.attMass) * (Scalar (1) / mass);
+    return CjrlSpatialInertiaTpl
+      (mass, centerOfMass,
+       attInertiaMatrix + inInertia.attInertiaMatrix
+       + steiner(attMass, attCenterOfMass - centerOfMass)
+       + steiner(inInertia.attMass,
+		 inInertia.attCenterOfMass - centerOfMass));
+  }
+
+  CjrlSpatialInertiaTpl& operator+=(const CjrlSpatialInertiaTpl& inInertia)
+  {
+    *this = *this + inInertia;
+    return *this;
+  }
+
+private:
+  /// \brief Get the inertia matrix of a point mass at a given position.
+  static matrix3d steiner(const Scalar& inMass, const vector3d& inPosition)
+  {
+    const Scalar squaredNorm = tools::dot(inPosition, inPosition);
+    matrix3d result;
+    for (unsigned int i = 0; i < 3; ++i)
+      for (unsigned int j = 0; j < 3; ++j)
+	result(i,j) = inMass * ((i == j ? squaredNorm : Scalar (0))
+				- inPosition(i) * inPosition(j));
+    return result;
+  }
+
+  /// \brief Mass.
+  Scalar attMass;
+  /// \brief Position of the center of mass.
+  vector3d attCenterOfMass;
+  /// \brief Inertia matrix at the center of mass.
+  matrix3d attInertiaMatrix;
+};
+
+/**
+   \brief This class represents a rigid-body transformation.
+
+   The transformation \f$M \in SE(3)\f$ is represented by a rotation
+   matrix \f$R\f$ and a translation vector \f${\bf p}\f$, which makes
+   compositions cheaper than with homogeneous matrices. It maps the
+   coordinates \f${\bf x}\f$ of a point in a local frame to
+   \f$R{\bf x} + {\bf p}\f$.
+
+   CjrlRigidTransformation is the instantiation for double.
+*/
+template <typename Scalar>
+class CjrlRigidTransformationTpl
+{
+public:
+  typedef typename CjrlScalarTraits<Scalar>::vector3d vector3d;
+  typedef typename CjrlScalarTraits<Scalar>::matrix3d matrix3d;
+  typedef typename CjrlScalarTraits<Scalar>::matrix4d matrix4d;
+  typedef CjrlSpatialAlgebraToolsTpl<Scalar> tools;
+
+  /// \brief Constructor of the identity transformation.
+  CjrlRigidTransformationTpl()
+    : attRotation (tools::identity()),
+      attTranslation (Scalar (0), Scalar (0), Scalar (0))
+  {}
+
+  /// \brief Constructor.
+  CjrlRigidTransformationTpl(const matrix3d& inRotation,
+			     const vector3d& inTranslation)
+    : attRotation (inRotation),
+      attTranslation (inTranslation)
+  {}
+
+  /// \brief Constructor from an homogeneous matrix.
+  explicit CjrlRigidTransformationTpl(const matrix4d& inMatrix)
+    : attRotation (),
+      attTranslation (inMatrix(0,3), inMatrix(1,3), inMatrix(2,3))
+  {
+    for (unsigned int i = 0; i < 3; ++i)
+      for (unsigned int j = 0; j < 3; ++j)
+	attRotation(i,j) = inMatrix(i,j);
+  }
+
+  /// \brief Get the rotation matrix.
+  const matrix3d& rotation() const
+  {
+    return attRotation;
+  }
+
+  /// \brief Set the rotation matrix.
+  void rotation(const matrix3d& inRotation)
+  {
+    attRotation = inRotation;
+  }
+
+  /// \brief Get the translation vector.
+  const vector3d& translation() const
+  {
+    return attTranslation;
+  }
+
+  /// \brief Set the translation vector.
+  void translation(const vector3d& inTranslation)
+  {
+    attTranslation = inTranslation;
+  }
+
+  /// \brief Convert into an homogeneous matrix.
+  void homogeneousMatrix(matrix4d& outMatrix) const
+  {
+    for (unsigned int i = 0; i < 3; ++i)
+      {
+	for (unsigned int j = 0; j < 3; ++j)
+	  outMatrix(i,j) = attRotation(i,j);
+	outMatrix(i,3) = attTranslation(i);
+	outMatrix(3,i) = Scalar (0);
+      }
+    outMatrix(3,3) = Scalar (1);
+  }
+
+  /// \brief Compose two transformations.
+  CjrlRigidTransformationTpl
+  operator*(const CjrlRigidTransformationTpl& inTransformation) const
+  {
+    return CjrlRigidTransformationTpl
+      (tools::multiply(attRotation, inTransformation.attRotation),
+       tools::multiply(attRotation, inTransformation.attTranslation)
+       + attTranslation);
+  }
+
+  /// \brief Get the inverse transformation.
+  CjrlRigidTransformationTpl inverse() const
+  {
+    return CjrlRigidTransformationTpl
+      (tools::transpose(attRotation),
+       tools::transposeMultiply(attRotation, attTranslation) * Scalar (-1));
+  }
+
+  /// \brief Transform a point from the local frame.
+  vector3d act(const vector3d& inPoint) const
+  {
+    return tools::multiply(attRotation, inPoint) + attTranslation;
+  }
+
+  /// \brief Transform a point into the local frame.
+  vector3d actInv(const vector3d& inPoint) const
+  {
+    return tools::transposeMultiply(attRotation, inPoint - attTranslation);
+  }
+
+  /// \brief Express a motion given in the local frame.
+  CjrlSpatialMotionTpl<Scalar>
+  act(const CjrlSpatialMotionTpl<Scalar>& inMotion) const
+  {
+    const vector3d angular = tools::multiply(attRotation, inMotion.angular());
+    return CjrlSpatialMotionTpl<Scalar>
+      (tools::multiply(attRotation, inMotion.linear())
+       + tools::cross(attTranslation, angular),
+       angular);
+  }
+
+  /// \brief Express a motion in the local frame.
+  CjrlSpatialMotionTpl<Scalar>
+  actInv(const CjrlSpatialMotionTpl<Scalar>& inMotion) const
+  {
+    return CjrlSpatialMotionTpl<Scalar>
+      (tools::transposeMultiply(attRotation,
+				inMotion.linear()
+				- tools::cross(attTranslation,
+					       inMotion.angular())),
+       tools::transposeMultiply(attRotation, inMotion.angular()));
+  }
+
+  /// \brief Express a force given in the local frame.
+  CjrlSpatialForceTpl<Scalar>
+  act(const CjrlSpatialForceTpl<Scalar>& inForce) const
+  {
+    const vector3d linear = tools::multiply(attRotation, inForce.linear());
+    return CjrlSpatialForceTpl<Scalar>
+      (linear,
+       tools::multiply(attRotation, inForce.angular())
+       + tools::cross(attTranslation, linear));
+  }
+
+  /// \brief Express a force in the local frame.
+  CjrlSpatialForceTpl<Scalar>
+  actInv(const CjrlSpatialForceTpl<Scalar>& inForce) const
+  {
+    return CjrlSpatialForceTpl<Scalar>
+      (tools::transposeMultiply(attRotation, inForce.linear()),
+       tools::transposeMultiply(attRotation,
+				inForce.angular()
+				- tools::cross(attTranslation,
+					       inForce.linear())));
+  }
+
+private:
+  /// \brief Rotation matrix.
+  matrix3d attRotation;
+  /// \brief Translation vector.
+  vector3d attTranslation;
+};
+
+#endif //! ABSTRACT_ROBOT_DYNAMICS_SPATIAL_ALGEBRA_HH
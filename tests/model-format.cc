@@ -0,0 +1,70 @@
+// Copyright 2026, CNRS/AIST
+//
+// This file is part of abstract-robot-dynamics.
+// abstract-robot-dynamics is free software: you can redistribute it
+// and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either
+// version 3 of the License, or (at your option) any later version.
+//
+// abstract-robot-dynamics is distributed in the hope that it will be
+// useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+// of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.  You should
+// have received a copy of the GNU Lesser General Public License along
+// with abstract-robot-dynamics.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#include <cstddef>
+
+#include "common.hh"
+
+#define BOOST_TEST_MODULE model_format
+
+#include <boost/test/unit_test.hpp>
+
+// The binary model format is mapped in place: its records must have
+// the documented size and no implicit padding on every platform.
+
+BOOST_AUTO_TEST_CASE (record_sizes)
+{
+  BOOST_CHECK_EQUAL (sizeof (CjrlModelFileSection), 16u);
+  BOOST_CHECK_EQUAL (sizeof (CjrlModelFileHumanoid), 96u);
+  BOOST_CHECK_EQUAL (sizeof (CjrlModelFileHeader), 232u);
+  BOOST_CHECK_EQUAL (sizeof (CjrlModelFileJoint), 128u);
+  BOOST_CHECK_EQUAL (sizeof (CjrlModelFileConfigurationDof), 16u);
+  BOOST_CHECK_EQUAL (sizeof (CjrlModelFileVelocityDof), 56u);
+  BOOST_CHECK_EQUAL (sizeof (CjrlModelFileBody), 112u);
+  BOOST_CHECK_EQUAL (sizeof (CjrlModelFileHand), 104u);
+  BOOST_CHECK_EQUAL (sizeof (CjrlModelFileFoot), 48u);
+}
+
+BOOST_AUTO_TEST_CASE (header_layout)
+{
+  BOOST_CHECK_EQUAL (offsetof (CjrlModelFileHeader, version), 4u);
+  BOOST_CHECK_EQUAL (offsetof (CjrlModelFileHeader, fileSize), 16u);
+  BOOST_CHECK_EQUAL (offsetof (CjrlModelFileHeader, joints), 24u);
+  BOOST_CHECK_EQUAL (offsetof (CjrlModelFileHeader, configurationDofs), 40u);
+  BOOST_CHECK_EQUAL (offsetof (CjrlModelFileHeader, velocityDofs), 56u);
+  BOOST_CHECK_EQUAL (offsetof (CjrlModelFileHeader, names), 120u);
+  BOOST_CHECK_EQUAL (offsetof (CjrlModelFileHeader, humanoid), 136u);
+  BOOST_CHECK_EQUAL (offsetof (CjrlModelFileHumanoid, gazeOrigin), 48u);
+}
+
+BOOST_AUTO_TEST_CASE (record_layout)
+{
+  BOOST_CHECK_EQUAL (offsetof (CjrlModelFileJoint, numberVelocityDof), 28u);
+  BOOST_CHECK_EQUAL (offsetof (CjrlModelFileJoint, initialPosition), 32u);
+  BOOST_CHECK_EQUAL (offsetof (CjrlModelFileBody, joint), 104u);
+  BOOST_CHECK_EQUAL (offsetof (CjrlModelFileHand, center), 8u);
+  BOOST_CHECK_EQUAL (offsetof (CjrlModelFileFoot, soleLength), 8u);
+}
+
+BOOST_AUTO_TEST_CASE (header_flags)
+{
+  CjrlModelFileHeader header = CjrlModelFileHeader();
+  header.flags |= CjrlModelFileHeader::HUMANOID;
+
+  const uint32_t& humanoid = CjrlModelFileHeader::HUMANOID;
+  BOOST_CHECK_EQUAL (header.flags, humanoid);
+  BOOST_CHECK_EQUAL (header.flags & CjrlModelFileHeader::HUMANOID, 1u);
+}
@@ -0,0 +1,129 @@
+// Copyright 2026, CNRS/AIST
+//
+// This file is part of abstract-robot-dynamics.
+// abstract-robot-dynamics is free software: you can redistribute it
+// and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either
+// version 3 of the License, or (at your option) any later version.
+//
+// abstract-robot-dynamics is distributed in the hope that it will be
+// useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+// of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.  You should
+// have received a copy of the GNU Lesser General Public License along
+// with abstract-robot-dynamics.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#include <cstddef>
+
+#include "common.hh"
+
+#define BOOST_TEST_MODULE real_time_mode
+
+#include <boost/test/unit_test.hpp>
+
+// Robot defining only the pure virtual methods, so that the default
+// implementation of the real-time mode is used.
+class Robot : public CjrlDynamicRobot
+{
+public:
+  typedef std::vector<CjrlJoint*> joints_t;
+
+  virtual bool initialize() { return true; }
+  virtual void rootJoint(CjrlJoint&) {}
+  virtual CjrlJoint* rootJoint() const { return 0; }
+  virtual joints_t jointVector() { return joints_; }
+  virtual joints_t jointsBetween(const CjrlJoint&, const CjrlJoint&) const
+  {
+    return joints_;
+  }
+  virtual double upperBoundDof(unsigned int) { return 0; }
+  virtual double lowerBoundDof(unsigned int) { return 0; }
+  virtual double upperBoundDof(unsigned int, const vectorN&) { return 0; }
+  virtual double lowerBoundDof(unsigned int, const vectorN&) { return 0; }
+  virtual double upperVelocityBoundDof(unsigned int) { return 0; }
+  virtual double lowerVelocityBoundDof(unsigned int) { return 0; }
+  virtual double upperTorqueBoundDof(unsigned int) { return 0; }
+  virtual double lowerTorqueBoundDof(unsigned int) { return 0; }
+  virtual unsigned int numberDof() const { return 0; }
+  virtual void setJointOrderInConfig(joints_t) {}
+  virtual bool currentConfiguration(const vectorN&) { return false; }
+  virtual const vectorN& currentConfiguration() const { return vector_; }
+  virtual bool currentVelocity(const vectorN&) { return false; }
+  virtual const vectorN& currentVelocity() const { return vector_; }
+  virtual bool currentAcceleration(const vectorN&) { return false; }
+  virtual const vectorN& currentAcceleration() const { return vector_; }
+  virtual const matrixNxP& currentForces() const { return matrix_; }
+  virtual const matrixNxP& currentTorques() const { return matrix_; }
+  virtual const vectorN& currentJointTorques() const { return vector_; }
+  virtual bool computeForwardKinematics() { return false; }
+  virtual bool computeCenterOfMassDynamics() { return false; }
+  virtual double mass() const { return 0; }
+  virtual const vector3d& positionCenterOfMass() const { return point_; }
+  virtual const vector3d& velocityCenterOfMass() { return point_; }
+  virtual const vector3d& accelerationCenterOfMass() { return point_; }
+  virtual const vector3d& linearMomentumRobot() { return point_; }
+  virtual const vector3d& derivativeLinearMomentum() { return point_; }
+  virtual const vector3d& angularMomentumRobot() { return point_; }
+  virtual const vector3d& derivativeAngularMomentum() { return point_; }
+  virtual bool getJacobian(const CjrlJoint&, const CjrlJoint&,
+			   const vector3d&, matrixNxP&,
+			   unsigned int, bool)
+  {
+    return false;
+  }
+  virtual bool getPositionJacobian(const CjrlJoint&, const CjrlJoint&,
+				   const vector3d&, matrixNxP&,
+				   unsigned int, bool)
+  {
+    return false;
+  }
+  virtual bool getOrientationJacobian(const CjrlJoint&, const CjrlJoint&,
+				      matrixNxP&, unsigned int, bool)
+  {
+    return false;
+  }
+  virtual bool getJacobianCenterOfMass(const CjrlJoint&, matrixNxP&,
+				       unsigned int, bool)
+  {
+    return false;
+  }
+  virtual void computeInertiaMatrix() {}
+  virtual const matrixNxP& inertiaMatrix() const { return matrix_; }
+  virtual const joints_t& getActuatedJoints() const { return joints_; }
+  virtual void setActuatedJoints(joints_t&) {}
+
+private:
+  joints_t joints_;
+  vectorN vector_;
+  matrixNxP matrix_;
+  vector3d point_;
+};
+
+static std::size_t allocatedSize = 0;
+
+static void
+countAllocation(const char*, std::size_t inSize)
+{
+  allocatedSize += inSize;
+}
+
+BOOST_AUTO_TEST_CASE (allocation_hook)
+{
+  CjrlDynamicRobot::AllocationHook hook = &countAllocation;
+  hook("allocation_hook", 16);
+  BOOST_CHECK_EQUAL (allocatedSize, 16u);
+}
+
+BOOST_AUTO_TEST_CASE (default_real_time_mode)
+{
+  Robot robot;
+  CjrlDynamicRobot& base = robot;
+
+  BOOST_CHECK (!base.isRealTimeMode());
+  BOOST_CHECK (!base.enterRealTimeMode(&countAllocation));
+  BOOST_CHECK (!base.isRealTimeMode());
+  BOOST_CHECK (!base.enterRealTimeMode(0));
+  base.leaveRealTimeMode();
+  BOOST_CHECK (!base.isRealTimeMode());
+}
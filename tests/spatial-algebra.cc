@@ -0,0 +1,136 @@
+// Copyright 2026, CNRS/AIST
+//
+// This file is part of abstract-robot-dynamics.
+// abstract-robot-dynamics is free software: you can redistribute it
+// and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either
+// version 3 of the License, or (at your option) any later version.
+//
+// abstract-robot-dynamics is distributed in the hope that it will be
+// useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+// of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.  You should
+// have received a copy of the GNU Lesser General Public License along
+// with abstract-robot-dynamics.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#include <cmath>
+
+#include "common.hh"
+
+#define BOOST_TEST_MODULE spatial_algebra
+
+#include <boost/test/unit_test.hpp>
+
+typedef CjrlSpatialAlgebraToolsTpl<double> tools;
+
+static const double tolerance = 1e-12;
+
+// Rotation of angle inAngle about unit axis inAxis (Rodrigues formula).
+static matrix3d
+rotation(const vector3d& inAxis, double inAngle)
+{
+  const double c = std::cos(inAngle);
+  const double s = std::sin(inAngle);
+  matrix3d R = tools::zero();
+  for (unsigned int i = 0; i < 3; ++i)
+    for (unsigned int j = 0; j < 3; ++j)
+      R(i,j) = (1 - c) * inAxis(i) * inAxis(j) + (i == j ? c : 0.);
+  R(0,1) -= s * inAxis(2); R(1,0) += s * inAxis(2);
+  R(0,2) += s * inAxis(1); R(2,0) -= s * inAxis(1);
+  R(1,2) -= s * inAxis(0); R(2,1) += s * inAxis(0);
+  return R;
+}
+
+static CjrlRigidTransformation
+transformation()
+{
+  const double n = std::sqrt(0.09 + 0.16 + 1.44);
+  return CjrlRigidTransformation
+    (rotation(vector3d(0.3/n, -0.4/n, 1.2/n), 0.7),
+     vector3d(0.5, -1.2, 2.1));
+}
+
+static CjrlSpatialInertia
+inertia(double inMass, const vector3d& inCenterOfMass, double inDiagonal)
+{
+  matrix3d I = tools::identity();
+  for (unsigned int i = 0; i < 3; ++i)
+    I(i,i) = inDiagonal * (i + 1);
+  I(0,1) = I(1,0) = 0.1 * inDiagonal;
+  return CjrlSpatialInertia(inMass, inCenterOfMass, I);
+}
+
+static double
+distance(const vector3d& inA, const vector3d& inB)
+{
+  const vector3d d = inA - inB;
+  return std::sqrt(tools::dot(d, d));
+}
+
+static double
+distance(const CjrlSpatialMotion& inA, const CjrlSpatialMotion& inB)
+{
+  return distance(inA.linear(), inB.linear())
+    + distance(inA.angular(), inB.angular());
+}
+
+static double
+distance(const CjrlSpatialForce& inA, const CjrlSpatialForce& inB)
+{
+  return distance(inA.linear(), inB.linear())
+    + distance(inA.angular(), inB.angular());
+}
+
+static const CjrlSpatialMotion motion(vector3d(0.2, -1.5, 0.8),
+				      vector3d(-0.6, 0.4, 1.1));
+static const CjrlSpatialMotion otherMotion(vector3d(1.3, 0.7, -0.2),
+					   vector3d(0.5, -0.9, 0.3));
+static const CjrlSpatialForce force(vector3d(-2.1, 0.3, 4.2),
+				    vector3d(0.8, 1.6, -0.5));
+
+BOOST_AUTO_TEST_CASE (act_inverse)
+{
+  const CjrlRigidTransformation M = transformation();
+  const vector3d p(1.1, 0.2, -0.7);
+
+  BOOST_CHECK_SMALL (distance(M.actInv(M.act(p)), p), tolerance);
+  BOOST_CHECK_SMALL (distance(M.actInv(M.act(motion)), motion), tolerance);
+  BOOST_CHECK_SMALL (distance(M.actInv(M.act(force)), force), tolerance);
+  BOOST_CHECK_SMALL (distance(M.inverse().act(M.act(p)), p), tolerance);
+  BOOST_CHECK_SMALL (distance((M * M.inverse()).act(p), p), tolerance);
+}
+
+BOOST_AUTO_TEST_CASE (power_invariance)
+{
+  const CjrlRigidTransformation M = transformation();
+
+  BOOST_CHECK_SMALL (M.act(motion).dot(M.act(force)) - motion.dot(force),
+		     tolerance);
+  BOOST_CHECK_SMALL (M.actInv(motion).dot(M.actInv(force))
+		     - motion.dot(force), tolerance);
+}
+
+BOOST_AUTO_TEST_CASE (inertia_sum)
+{
+  const CjrlSpatialInertia I1 = inertia(2.5, vector3d(0.1, -0.3, 0.4), 0.2);
+  const CjrlSpatialInertia I2 = inertia(1.2, vector3d(-0.5, 0.2, 0.6), 0.05);
+
+  BOOST_CHECK_SMALL (distance((I1 + I2) * motion, I1 * motion + I2 * motion),
+		     tolerance);
+
+  CjrlSpatialInertia I = I1;
+  I += I2;
+  BOOST_CHECK_SMALL (distance(I * motion, I1 * motion + I2 * motion),
+		     tolerance);
+}
+
+BOOST_AUTO_TEST_CASE (cross_duality)
+{
+  // (v x m) . f = - m . (v x* f)
+  BOOST_CHECK_SMALL (motion.cross(otherMotion).dot(force)
+		     + otherMotion.dot(motion.cross(force)), tolerance);
+  // v x v = 0
+  BOOST_CHECK_SMALL (distance(motion.cross(motion), CjrlSpatialMotion()),
+		     tolerance);
+}